@@ -0,0 +1,122 @@
+#include "benchmark.h"
+
+#include "lua_compileoptions.h"
+#include "luau.h"
+
+#include <godot_cpp/templates/vector.hpp>
+
+using namespace gdluau;
+using namespace gdluau_bench;
+using namespace godot;
+
+// Compile throughput, measured per byte of source: MB/s = 1000 / ns_per_op
+
+static constexpr int SMALL_SCRIPT_COUNT = 200;
+static constexpr int LARGE_SCRIPT_FUNCTIONS = 2000;
+
+// A typical gameplay module: a table of methods with loops, branches, closures and vector math
+static String make_module(int p_index, int p_functions)
+{
+    String source = vformat("local Module%d = {}\nModule%d.__index = Module%d\n\n", p_index, p_index, p_index);
+
+    for (int i = 0; i < p_functions; i++)
+    {
+        source += vformat(R"(function Module%d:update_%d(dt: number, targets: {any})
+    local best, best_distance = nil, math.huge
+    for index, target in targets do
+        local offset = target.position - self.position
+        local distance = vector.magnitude(offset)
+        if distance < best_distance and target.health > 0 then
+            best, best_distance = target, distance
+        elseif index %% %d == 0 then
+            self.cooldown = math.max(0, self.cooldown - dt)
+        end
+    end
+    local callback = function(value) return value * %d + self.speed end
+    return best, callback(best_distance), string.format("%%s:%%d", self.name, %d)
+end
+
+)",
+                          p_index, i, i + 2, i, i);
+    }
+
+    source += vformat("return Module%d\n", p_index);
+    return source;
+}
+
+static int64_t total_length(const PackedStringArray &p_sources)
+{
+    int64_t length = 0;
+    for (const String &source : p_sources)
+    {
+        length += source.utf8().length();
+    }
+
+    return length;
+}
+
+static Dictionary corpus_info(const PackedStringArray &p_sources, int64_t p_bytes)
+{
+    Dictionary extra;
+    extra["scripts"] = p_sources.size();
+    extra["source_bytes"] = p_bytes;
+    return extra;
+}
+
+GDLUAU_BENCHMARK(compile_throughput)
+{
+    PackedStringArray small_scripts;
+    for (int i = 0; i < SMALL_SCRIPT_COUNT; i++)
+    {
+        small_scripts.push_back(make_module(i, 4 + i % 8));
+    }
+
+    PackedStringArray large_script;
+    large_script.push_back(make_module(0, LARGE_SCRIPT_FUNCTIONS));
+
+    Ref<LuaCompileOptions> optimized;
+    optimized.instantiate();
+    optimized->set_optimization_level(2);
+
+    struct CompilePayload
+    {
+        const char *name;
+        const PackedStringArray &sources;
+        const LuaCompileOptions *options;
+    };
+
+    CompilePayload payloads[] = {
+        {"small_scripts", small_scripts, nullptr},
+        {"small_scripts/O2", small_scripts, optimized.ptr()},
+        {"large_script", large_script, nullptr},
+        {"large_script/O2", large_script, optimized.ptr()},
+    };
+
+    for (const CompilePayload &payload : payloads)
+    {
+        int64_t bytes = total_length(payload.sources);
+        bench.measure(payload.name, bytes, [&]()
+                      {
+            for (const String &source : payload.sources)
+            {
+                PackedByteArray bytecode = Luau::compile(source, payload.options);
+                (void)bytecode;
+            } }, corpus_info(payload.sources, bytes));
+    }
+
+    // Same corpus spread over the WorkerThreadPool
+    int64_t bytes = total_length(small_scripts);
+    bench.measure("small_scripts/async", bytes, [&]()
+                  {
+        Vector<Ref<LuauCompileTask>> tasks;
+        for (const String &source : small_scripts)
+        {
+            tasks.push_back(Luau::compile_async(source));
+        }
+
+        for (const Ref<LuauCompileTask> &task : tasks)
+        {
+            PackedByteArray bytecode = task->wait();
+            (void)bytecode;
+        } }, corpus_info(small_scripts, bytes));
+}
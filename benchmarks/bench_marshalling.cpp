@@ -0,0 +1,264 @@
+#include "benchmark.h"
+
+#include "bridging/array.h"
+#include "bridging/callable.h"
+#include "bridging/dictionary.h"
+#include "bridging/variant.h"
+
+#include <lua.h>
+
+using namespace gdluau;
+using namespace gdluau_bench;
+using namespace godot;
+
+static constexpr int64_t SCALAR_OPS = 100000;
+static constexpr int64_t CONTAINER_OPS = 1000;
+static constexpr int64_t LARGE_OPS = 20;
+
+static constexpr int LARGE_ARRAY_SIZE = 10000;
+
+struct Payload
+{
+    const char *name;
+    Variant value;
+    int64_t ops;
+};
+
+static Dictionary make_nested_dictionary(int p_depth)
+{
+    Dictionary dict;
+    dict["name"] = "node";
+    dict["health"] = 100.0;
+    dict["position"] = Vector3(1, 2, 3);
+    dict["tags"] = Array::make("a", "b", "c");
+
+    if (p_depth > 0)
+    {
+        dict["left"] = make_nested_dictionary(p_depth - 1);
+        dict["right"] = make_nested_dictionary(p_depth - 1);
+    }
+
+    return dict;
+}
+
+static Array make_large_array()
+{
+    Array arr;
+    arr.resize(LARGE_ARRAY_SIZE);
+    for (int i = 0; i < LARGE_ARRAY_SIZE; i++)
+    {
+        arr[i] = i;
+    }
+
+    return arr;
+}
+
+static PackedFloat32Array make_large_packed_array()
+{
+    PackedFloat32Array arr;
+    arr.resize(LARGE_ARRAY_SIZE);
+    for (int i = 0; i < LARGE_ARRAY_SIZE; i++)
+    {
+        arr[i] = static_cast<float>(i);
+    }
+
+    return arr;
+}
+
+static std::vector<Payload> make_payloads()
+{
+    return {
+        {"int", 42, SCALAR_OPS},
+        {"float", 3.25, SCALAR_OPS},
+        {"string", "the quick brown fox", SCALAR_OPS},
+        {"vector3", Vector3(1, 2, 3), SCALAR_OPS},
+        {"color", Color(0.1, 0.2, 0.3, 1.0), SCALAR_OPS},
+        {"transform3d", Transform3D(Basis(), Vector3(1, 2, 3)), SCALAR_OPS},
+        {"nested_dictionary", make_nested_dictionary(3), CONTAINER_OPS},
+        {"array_10k", make_large_array(), LARGE_OPS},
+        {"packed_float32_array_10k", make_large_packed_array(), LARGE_OPS},
+    };
+}
+
+GDLUAU_BENCHMARK(marshalling_push_variant)
+{
+    Ref<LuaState> state = new_counted_lua_state();
+    lua_State *L = state->get_lua_state();
+
+    for (const Payload &payload : make_payloads())
+    {
+        bench.measure(payload.name, payload.ops, [&]()
+                      {
+            for (int64_t i = 0; i < payload.ops; i++)
+            {
+                push_variant(L, payload.value);
+                lua_pop(L, 1);
+            } });
+    }
+}
+
+GDLUAU_BENCHMARK(marshalling_to_variant)
+{
+    Ref<LuaState> state = new_counted_lua_state();
+    lua_State *L = state->get_lua_state();
+
+    for (const Payload &payload : make_payloads())
+    {
+        push_variant(L, payload.value);
+        bench.measure(payload.name, payload.ops, [&]()
+                      {
+            for (int64_t i = 0; i < payload.ops; i++)
+            {
+                Variant value = to_variant(L, -1);
+                (void)value;
+            } });
+        lua_pop(L, 1);
+    }
+}
+
+GDLUAU_BENCHMARK(marshalling_to_array)
+{
+    Ref<LuaState> state = new_counted_lua_state();
+    lua_State *L = state->get_lua_state();
+
+    struct ArrayPayload
+    {
+        const char *name;
+        Array value;
+        int64_t ops;
+    };
+
+    ArrayPayload payloads[] = {
+        {"small", Array::make(1, "two", 3.0, Vector3(4, 4, 4)), SCALAR_OPS / 10},
+        {"array_of_dictionaries", Array::make(make_nested_dictionary(1), make_nested_dictionary(1), make_nested_dictionary(1)), CONTAINER_OPS},
+        {"array_10k", make_large_array(), LARGE_OPS},
+    };
+
+    for (const ArrayPayload &payload : payloads)
+    {
+        push_array(L, payload.value);
+        bench.measure(payload.name, payload.ops, [&]()
+                      {
+            for (int64_t i = 0; i < payload.ops; i++)
+            {
+                Array arr = to_array(L, -1);
+                (void)arr;
+            } });
+        lua_pop(L, 1);
+    }
+}
+
+GDLUAU_BENCHMARK(marshalling_to_dictionary)
+{
+    Ref<LuaState> state = new_counted_lua_state();
+    lua_State *L = state->get_lua_state();
+
+    Dictionary flat;
+    for (int i = 0; i < 16; i++)
+    {
+        flat[vformat("key_%d", i)] = i;
+    }
+
+    struct DictionaryPayload
+    {
+        const char *name;
+        Dictionary value;
+        int64_t ops;
+    };
+
+    DictionaryPayload payloads[] = {
+        {"flat_16", flat, SCALAR_OPS / 10},
+        {"nested_depth_3", make_nested_dictionary(3), CONTAINER_OPS},
+    };
+
+    for (const DictionaryPayload &payload : payloads)
+    {
+        push_dictionary(L, payload.value);
+        bench.measure(payload.name, payload.ops, [&]()
+                      {
+            for (int64_t i = 0; i < payload.ops; i++)
+            {
+                Dictionary dict = to_dictionary(L, -1);
+                (void)dict;
+            } });
+        lua_pop(L, 1);
+    }
+}
+
+GDLUAU_BENCHMARK(marshalling_callable)
+{
+    Ref<LuaState> state = new_counted_lua_state();
+    lua_State *L = state->get_lua_state();
+
+    // Godot -> Lua
+    Callable godot_callable(state.ptr(), "get_top");
+    bench.measure("push_callable", SCALAR_OPS, [&]()
+                  {
+        for (int64_t i = 0; i < SCALAR_OPS; i++)
+        {
+            push_callable(L, godot_callable);
+            lua_pop(L, 1);
+        } });
+
+    state->push_callable(Callable(state.ptr(), "is_valid"));
+    state->set_global("is_valid");
+    state->do_string("return function(n) for i = 1, n do is_valid() end end", "=bench_godot_call", 0, 0, 1);
+    lua_pushinteger(L, SCALAR_OPS);
+    bench.measure("godot_callable_call", SCALAR_OPS, [&]()
+                  {
+        lua_pushvalue(L, -2);
+        lua_pushvalue(L, -2);
+        lua_call(L, 1, 0); });
+    lua_pop(L, 2);
+
+    // Lua -> Godot
+    state->do_string("return function(a, b) return a + b end", "=bench_add", 0, 0, 1);
+    Callable lua_callable = to_callable(L, -1);
+    lua_pop(L, 1);
+
+    bench.measure("lua_callable_call", SCALAR_OPS, [&]()
+                  {
+        for (int64_t i = 0; i < SCALAR_OPS; i++)
+        {
+            Variant result = lua_callable.call(i, 2);
+            (void)result;
+        } });
+
+    state->do_string("return setmetatable({}, { __call = function(self, a, b) return a + b end })", "=bench_call_table", 0, 0, 1);
+    Callable lua_call_table = to_callable(L, -1);
+    lua_pop(L, 1);
+
+    bench.measure("lua_callable_call/__call", SCALAR_OPS, [&]()
+                  {
+        for (int64_t i = 0; i < SCALAR_OPS; i++)
+        {
+            Variant result = lua_call_table.call(i, 2);
+            (void)result;
+        } });
+
+    state->do_string("local inner = setmetatable({}, { __call = function(self, a, b) return a + b end }); return setmetatable({}, { __call = inner })", "=bench_call_nested", 0, 0, 1);
+    Callable lua_call_nested = to_callable(L, -1);
+    lua_pop(L, 1);
+
+    bench.measure("lua_callable_call/__call_nested", SCALAR_OPS, [&]()
+                  {
+        for (int64_t i = 0; i < SCALAR_OPS; i++)
+        {
+            Variant result = lua_call_nested.call(i, 2);
+            (void)result;
+        } });
+
+    // Round-trips the argument through Lua in both directions
+    state->do_string("return function(value) return value end", "=bench_identity", 0, 0, 1);
+    Callable lua_identity = to_callable(L, -1);
+    lua_pop(L, 1);
+
+    Dictionary payload = make_nested_dictionary(1);
+    bench.measure("lua_callable_call/dictionary_arg", CONTAINER_OPS, [&]()
+                  {
+        for (int64_t i = 0; i < CONTAINER_OPS; i++)
+        {
+            Variant result = lua_identity.call(payload);
+            (void)result;
+        } });
+}
@@ -0,0 +1,49 @@
+#include "benchmark.h"
+
+#include <godot_cpp/classes/resource.hpp>
+#include <lua.h>
+
+using namespace gdluau;
+using namespace gdluau_bench;
+using namespace godot;
+
+static constexpr int64_t PROPERTY_OPS = 100000;
+
+// Property access through the cached accessors in Object.__index/__newindex, against the
+// generic Object::get/set path that they replace
+GDLUAU_BENCHMARK(object_property)
+{
+    Ref<LuaState> state = new_counted_lua_state();
+    lua_State *L = state->get_lua_state();
+
+    Ref<Resource> resource;
+    resource.instantiate();
+    resource->set_name("bench");
+    state->push_variant(resource);
+    state->set_global("resource");
+
+    struct PropertyCase
+    {
+        const char *name;
+        const char *source;
+    };
+
+    PropertyCase cases[] = {
+        {"index/accessor", "return function(n) for i = 1, n do local _ = resource.resource_name end end"},
+        {"index/object_get", "return function(n) for i = 1, n do local _ = resource:get('resource_name') end end"},
+        {"newindex/accessor", "return function(n) for i = 1, n do resource.resource_name = 'bench' end end"},
+        {"newindex/object_set", "return function(n) for i = 1, n do resource:set('resource_name', 'bench') end end"},
+    };
+
+    for (const PropertyCase &property_case : cases)
+    {
+        state->do_string(property_case.source, vformat("=bench_%s", property_case.name), 0, 0, 1);
+        lua_pushinteger(L, PROPERTY_OPS);
+        bench.measure(property_case.name, PROPERTY_OPS, [&]()
+                      {
+            lua_pushvalue(L, -2);
+            lua_pushvalue(L, -2);
+            lua_call(L, 1, 0); });
+        lua_pop(L, 2);
+    }
+}
@@ -0,0 +1,115 @@
+#include "benchmark.h"
+
+#include "string_cache.h"
+
+#include <godot_cpp/variant/char_string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <atomic>
+#include <thread>
+
+using namespace gdluau;
+using namespace godot;
+
+// Property and method names as seen on the marshalling path
+static constexpr int VOCABULARY_SIZE = 256;
+
+static constexpr int64_t OPS_PER_THREAD = 100000;
+
+static const int THREAD_COUNTS[] = {1, 2, 4, 8};
+
+// Runs p_body(thread_index) on p_threads threads, releasing them together so they contend on the cache
+template <typename F>
+static void run_on_threads(int p_threads, F &p_body)
+{
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(p_threads);
+
+    for (int t = 0; t < p_threads; t++)
+    {
+        threads.emplace_back([&go, &p_body, t]()
+                             {
+            while (!go.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            p_body(t); });
+    }
+
+    go.store(true, std::memory_order_release);
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Measures aggregate throughput: with a scalable cache, ns/op should drop as threads are added
+GDLUAU_BENCHMARK(string_cache_contention)
+{
+    std::vector<CharString> keys;
+    std::vector<StringName> names;
+    std::vector<int16_t> atoms;
+
+    for (int i = 0; i < VOCABULARY_SIZE; i++)
+    {
+        String key = vformat("bench_key_%d", i);
+        CharString utf8 = key.utf8();
+
+        int16_t atom = create_atom(utf8.get_data(), utf8.length());
+        if (atom < 0)
+        {
+            // Colliding keys aren't cached, so they'd measure the fallback path instead
+            continue;
+        }
+
+        keys.push_back(utf8);
+        names.push_back(StringName(key));
+        atoms.push_back(atom);
+    }
+
+    const size_t count = keys.size();
+
+    for (int thread_count : THREAD_COUNTS)
+    {
+        Dictionary extra;
+        extra["threads"] = thread_count;
+
+        auto lookup_atoms = [&](int p_thread)
+        {
+            for (int64_t i = 0; i < OPS_PER_THREAD; i++)
+            {
+                StringName name = string_name_for_atom(atoms[(i + p_thread) % count]);
+                (void)name;
+            }
+        };
+        bench.measure(vformat("string_name_for_atom/threads:%d", thread_count), OPS_PER_THREAD * thread_count, [&]()
+                      { run_on_threads(thread_count, lookup_atoms); }, extra);
+
+        auto convert_names = [&](int p_thread)
+        {
+            for (int64_t i = 0; i < OPS_PER_THREAD; i++)
+            {
+                CharString str = char_string(names[(i + p_thread) % count]);
+                (void)str;
+            }
+        };
+        bench.measure(vformat("char_string/threads:%d", thread_count), OPS_PER_THREAD * thread_count, [&]()
+                      { run_on_threads(thread_count, convert_names); }, extra);
+
+        // Note that create_atom also constructs a StringName, which goes through Godot's own interning lock
+        auto intern_keys = [&](int p_thread)
+        {
+            for (int64_t i = 0; i < OPS_PER_THREAD; i++)
+            {
+                const CharString &key = keys[(i + p_thread) % count];
+                int16_t atom = create_atom(key.get_data(), key.length());
+                (void)atom;
+            }
+        };
+        bench.measure(vformat("create_atom/threads:%d", thread_count), OPS_PER_THREAD * thread_count, [&]()
+                      { run_on_threads(thread_count, intern_keys); }, extra);
+    }
+}
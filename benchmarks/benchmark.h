@@ -0,0 +1,118 @@
+// Minimal benchmark harness for the gdluau_benchmarks library
+// Benchmarks register themselves with GDLUAU_BENCHMARK and are run by LuauGDExtensionBenchmarks::run()
+
+#pragma once
+
+#include "lua_state.h"
+
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace gdluau_bench
+{
+    using namespace godot;
+
+    using gdluau::LuaState;
+
+    // Number of Luau heap allocations made so far by states from new_counted_lua_state(), across all threads.
+    // Only counts the Luau heap: Godot allocations are counted by godot_allocation_count().
+    uint64_t lua_allocation_count();
+
+    // Number of Godot heap allocations (memalloc, memrealloc, memnew, and the godot-cpp containers built on them)
+    // made so far by this library while LuauGDExtensionBenchmarks::run() is running, across all threads.
+    // Storage the engine allocates internally, such as the contents of Strings, Arrays and Dictionaries, is made
+    // on the engine side of the extension API and isn't counted; godot_static_memory_usage() covers it.
+    uint64_t godot_allocation_count();
+
+    // Bytes currently allocated by the engine and all extensions, as OS.get_static_memory_usage().
+    // Only tracked by debug builds of the engine, and is 0 otherwise.
+    uint64_t godot_static_memory_usage();
+
+    // Creates a LuaState with all libraries open, whose heap allocations are counted by lua_allocation_count()
+    Ref<LuaState> new_counted_lua_state();
+
+    class BenchmarkContext
+    {
+        String benchmark_name;
+        Array results;
+
+    public:
+        // Each case is run once to warm up, then timed over several samples, keeping the fastest
+        static constexpr int SAMPLES = 5;
+
+        explicit BenchmarkContext(const String &p_benchmark_name) : benchmark_name(p_benchmark_name) {}
+
+        static uint64_t now_ns();
+
+        // Times p_body, which must perform p_ops operations per invocation. Also reports, averaged per operation:
+        // - lua_allocs_per_op: Luau heap allocations, for states from new_counted_lua_state()
+        // - godot_allocs_per_op: Godot heap allocations made by this library (see godot_allocation_count())
+        // - godot_static_bytes_per_op: growth in the engine's static memory usage, i.e. bytes allocated and not
+        //   freed again, including engine-side String/Array/Dictionary storage (debug engine builds only)
+        template <typename F>
+        void measure(const String &p_case, int64_t p_ops, F &&p_body, const Dictionary &p_extra = Dictionary())
+        {
+            p_body();
+
+            uint64_t lua_allocs_before = lua_allocation_count();
+            uint64_t godot_allocs_before = godot_allocation_count();
+            uint64_t static_before = godot_static_memory_usage();
+            uint64_t best_ns = UINT64_MAX;
+            for (int i = 0; i < SAMPLES; i++)
+            {
+                uint64_t start = now_ns();
+                p_body();
+                uint64_t elapsed = now_ns() - start;
+
+                if (elapsed < best_ns)
+                {
+                    best_ns = elapsed;
+                }
+            }
+            uint64_t lua_allocs = lua_allocation_count() - lua_allocs_before;
+            uint64_t godot_allocs = godot_allocation_count() - godot_allocs_before;
+            int64_t static_growth = static_cast<int64_t>(godot_static_memory_usage() - static_before);
+
+            double total_ops = p_ops > 0 ? static_cast<double>(SAMPLES * p_ops) : 0.0;
+            Dictionary extra = p_extra.duplicate();
+            extra["lua_allocs_per_op"] = total_ops > 0 ? static_cast<double>(lua_allocs) / total_ops : 0.0;
+            extra["godot_allocs_per_op"] = total_ops > 0 ? static_cast<double>(godot_allocs) / total_ops : 0.0;
+            extra["godot_static_bytes_per_op"] = total_ops > 0 ? static_cast<double>(static_growth) / total_ops : 0.0;
+            record(p_case, p_ops, best_ns, extra);
+        }
+
+        // Records an externally timed result
+        void record(const String &p_case, int64_t p_ops, uint64_t p_elapsed_ns, const Dictionary &p_extra = Dictionary());
+
+        const Array &get_results() const { return results; }
+    };
+
+    typedef void (*BenchmarkFunc)(BenchmarkContext &bench);
+
+    struct BenchmarkEntry
+    {
+        const char *name;
+        BenchmarkFunc func;
+    };
+
+    // Uses std::vector because registration happens during static initialization,
+    // before Godot's allocator is available
+    std::vector<BenchmarkEntry> &benchmark_registry();
+
+    struct BenchmarkRegistration
+    {
+        BenchmarkRegistration(const char *p_name, BenchmarkFunc p_func)
+        {
+            benchmark_registry().push_back({p_name, p_func});
+        }
+    };
+} // namespace gdluau_bench
+
+#define GDLUAU_BENCHMARK(m_name)                                                                           \
+    static void m_name(gdluau_bench::BenchmarkContext &bench);                                             \
+    static gdluau_bench::BenchmarkRegistration m_name##_registration(#m_name, &m_name);                    \
+    static void m_name(gdluau_bench::BenchmarkContext &bench)
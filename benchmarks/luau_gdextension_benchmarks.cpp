@@ -0,0 +1,184 @@
+// C++ micro-benchmarks for the bridging layer
+// Built as separate GDExtension (gdluau_benchmarks)
+
+#include "luau_gdextension_benchmarks.h"
+
+#include "benchmark.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/godot.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <lualib.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+
+using namespace gdluau_bench;
+using namespace godot;
+
+static std::atomic<uint64_t> lua_allocations{0};
+
+// Same as Luau's default allocator, but counting every (re)allocation
+static void *counting_alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    if (nsize == 0)
+    {
+        free(ptr);
+        return nullptr;
+    }
+
+    lua_allocations.fetch_add(1, std::memory_order_relaxed);
+    return realloc(ptr, nsize);
+}
+
+uint64_t gdluau_bench::lua_allocation_count()
+{
+    return lua_allocations.load(std::memory_order_relaxed);
+}
+
+static std::atomic<uint64_t> godot_allocations{0};
+static GDExtensionInterfaceMemAlloc engine_mem_alloc = nullptr;
+static GDExtensionInterfaceMemRealloc engine_mem_realloc = nullptr;
+
+// Forward to the engine's allocator, counting every (re)allocation. Frees go to the engine directly.
+static void *counting_mem_alloc(size_t p_bytes)
+{
+    godot_allocations.fetch_add(1, std::memory_order_relaxed);
+    return engine_mem_alloc(p_bytes);
+}
+
+static void *counting_mem_realloc(void *p_ptr, size_t p_bytes)
+{
+    godot_allocations.fetch_add(1, std::memory_order_relaxed);
+    return engine_mem_realloc(p_ptr, p_bytes);
+}
+
+// godot-cpp allocates through these interface functions, so swapping them counts every allocation this library makes
+static void begin_counting_godot_allocations()
+{
+    engine_mem_alloc = internal::gdextension_interface_mem_alloc;
+    engine_mem_realloc = internal::gdextension_interface_mem_realloc;
+    internal::gdextension_interface_mem_alloc = counting_mem_alloc;
+    internal::gdextension_interface_mem_realloc = counting_mem_realloc;
+}
+
+static void end_counting_godot_allocations()
+{
+    internal::gdextension_interface_mem_alloc = engine_mem_alloc;
+    internal::gdextension_interface_mem_realloc = engine_mem_realloc;
+}
+
+uint64_t gdluau_bench::godot_allocation_count()
+{
+    return godot_allocations.load(std::memory_order_relaxed);
+}
+
+uint64_t gdluau_bench::godot_static_memory_usage()
+{
+    return OS::get_singleton()->get_static_memory_usage();
+}
+
+Ref<LuaState> gdluau_bench::new_counted_lua_state()
+{
+    // The LuaState takes ownership of the VM, closing it when freed
+    Ref<LuaState> state = LuaState::find_or_create_lua_state(lua_newstate(counting_alloc, nullptr));
+    state->open_libs();
+    return state;
+}
+
+uint64_t BenchmarkContext::now_ns()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void BenchmarkContext::record(const String &p_case, int64_t p_ops, uint64_t p_elapsed_ns, const Dictionary &p_extra)
+{
+    double ns_per_op = p_ops > 0 ? static_cast<double>(p_elapsed_ns) / static_cast<double>(p_ops) : 0.0;
+
+    Dictionary result = p_extra.duplicate();
+    result["benchmark"] = benchmark_name;
+    result["case"] = p_case;
+    result["ops"] = p_ops;
+    result["elapsed_ns"] = static_cast<int64_t>(p_elapsed_ns);
+    result["ns_per_op"] = ns_per_op;
+    results.push_back(result);
+
+    if (result.has("lua_allocs_per_op"))
+    {
+        UtilityFunctions::print(vformat("%s/%s: %.1f ns/op, %.2f Luau allocs/op, %.2f Godot allocs/op, %.1f retained bytes/op (%d ops)", benchmark_name, p_case, ns_per_op, result["lua_allocs_per_op"], result["godot_allocs_per_op"], result["godot_static_bytes_per_op"], p_ops));
+    }
+    else
+    {
+        UtilityFunctions::print(vformat("%s/%s: %.1f ns/op (%d ops)", benchmark_name, p_case, ns_per_op, p_ops));
+    }
+}
+
+std::vector<BenchmarkEntry> &gdluau_bench::benchmark_registry()
+{
+    static std::vector<BenchmarkEntry> registry;
+    return registry;
+}
+
+LuauGDExtensionBenchmarks::LuauGDExtensionBenchmarks()
+{
+}
+
+LuauGDExtensionBenchmarks::~LuauGDExtensionBenchmarks()
+{
+}
+
+void LuauGDExtensionBenchmarks::_bind_methods()
+{
+    ClassDB::bind_static_method("LuauGDExtensionBenchmarks", D_METHOD("run", "filter", "output_path"), &LuauGDExtensionBenchmarks::run, DEFVAL(String()), DEFVAL(String()));
+}
+
+Dictionary LuauGDExtensionBenchmarks::run(const String &p_filter, const String &p_output_path)
+{
+    Array all_results;
+
+    begin_counting_godot_allocations();
+
+    for (const BenchmarkEntry &entry : benchmark_registry())
+    {
+        String name(entry.name);
+        if (!p_filter.is_empty() && !name.contains(p_filter))
+        {
+            continue;
+        }
+
+        BenchmarkContext context(name);
+        entry.func(context);
+        all_results.append_array(context.get_results());
+    }
+
+    end_counting_godot_allocations();
+
+    Dictionary results;
+    results["success"] = true;
+    results["results"] = all_results;
+
+    if (!p_output_path.is_empty())
+    {
+        Ref<FileAccess> file = FileAccess::open(p_output_path, FileAccess::WRITE);
+        if (file.is_null())
+        {
+            ERR_PRINT(vformat("Could not open benchmark output file %s: %d", p_output_path, FileAccess::get_open_error()));
+            results["success"] = false;
+            return results;
+        }
+
+        for (const Variant &result : all_results)
+        {
+            file->store_line(JSON::stringify(result, "", false));
+        }
+    }
+
+    return results;
+}
@@ -0,0 +1,28 @@
+// C++ micro-benchmarks for the bridging layer
+// Built as separate GDExtension (gdluau_benchmarks)
+// Run via: godot --headless --path benchmarks/project -s run_benchmarks.gd
+
+#pragma once
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+class LuauGDExtensionBenchmarks : public Object
+{
+    GDCLASS(LuauGDExtensionBenchmarks, Object)
+
+protected:
+    static void _bind_methods();
+
+public:
+    LuauGDExtensionBenchmarks();
+    ~LuauGDExtensionBenchmarks();
+
+    // Run all benchmarks whose name contains p_filter (all if empty)
+    // Returns Dictionary with: {success: bool, results: Array[Dictionary]}
+    // Prints one line per case, and writes results as JSON lines to p_output_path if given
+    static Dictionary run(const String &p_filter = String(), const String &p_output_path = String());
+};
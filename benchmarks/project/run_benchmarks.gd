@@ -0,0 +1,27 @@
+## Headless runner for the C++ micro-benchmarks (gdluau_benchmarks)
+## Usage: godot --headless --path benchmarks/project -s run_benchmarks.gd -- [--filter=<name>] [--output=<path>]
+## Results are written as JSON lines, to bench_output.txt in the repository root by default.
+extends SceneTree
+
+func _initialize():
+    if not ClassDB.class_exists("LuauGDExtensionBenchmarks"):
+        push_error("LuauGDExtensionBenchmarks class not found - build with -DBUILD_BENCHMARKS=ON")
+        quit(1)
+        return
+
+    var filter := ""
+    var output := ProjectSettings.globalize_path("res://../../bench_output.txt")
+    for arg in OS.get_cmdline_user_args():
+        if arg.begins_with("--filter="):
+            filter = arg.trim_prefix("--filter=")
+        elif arg.begins_with("--output="):
+            output = arg.trim_prefix("--output=")
+
+    print("=== Running C++ Benchmarks ===")
+    print("")
+
+    var results = LuauGDExtensionBenchmarks.run(filter, output)
+
+    print("")
+    print("%d results written to %s" % [results.results.size(), output])
+    quit(0 if results.success else 1)
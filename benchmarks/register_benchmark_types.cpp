@@ -0,0 +1,45 @@
+// GDExtension registration for benchmark library
+#include "register_benchmark_types.h"
+#include "register_types.h"
+#include "luau_gdextension_benchmarks.h"
+
+#include <gdextension_interface.h>
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/godot.hpp>
+
+using namespace godot;
+
+void initialize_gdluau_benchmarks(ModuleInitializationLevel p_level)
+{
+    initialize_gdluau(p_level);
+
+    if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE)
+    {
+        return;
+    }
+
+    GDREGISTER_RUNTIME_CLASS(LuauGDExtensionBenchmarks);
+}
+
+void uninitialize_gdluau_benchmarks(ModuleInitializationLevel p_level)
+{
+    uninitialize_gdluau(p_level);
+}
+
+extern "C"
+{
+    // Initialization for benchmark GDExtension
+    GDExtensionBool GDE_EXPORT gdluau_benchmarks_entrypoint(
+        GDExtensionInterfaceGetProcAddress p_get_proc_address,
+        const GDExtensionClassLibraryPtr p_library,
+        GDExtensionInitialization *r_initialization)
+    {
+        godot::GDExtensionBinding::InitObject init_obj(p_get_proc_address, p_library, r_initialization);
+
+        init_obj.register_initializer(initialize_gdluau_benchmarks);
+        init_obj.register_terminator(uninitialize_gdluau_benchmarks);
+        init_obj.set_minimum_library_initialization_level(MODULE_INITIALIZATION_LEVEL_SCENE);
+
+        return init_obj.init();
+    }
+}
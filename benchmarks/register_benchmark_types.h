@@ -0,0 +1,9 @@
+// GDExtension registration for benchmark library
+#pragma once
+
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+void initialize_gdluau_benchmarks(ModuleInitializationLevel p_level);
+void uninitialize_gdluau_benchmarks(ModuleInitializationLevel p_level);
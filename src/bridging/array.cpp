@@ -1,9 +1,11 @@
 #include "bridging/array.h"
 
+#include "bridging/typed_element.h"
 #include "bridging/variant.h"
 #include "helpers.h"
 
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/object.hpp>
 #include <godot_cpp/variant/variant.hpp>
 #include <lua.h>
 
@@ -22,6 +24,7 @@ bool gdluau::is_array(lua_State *L, int p_index)
 
     ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 2), false, vformat("is_array(%d): Stack overflow. Cannot grow stack.", p_index));
 
+    int count = 0;
     int iter = 0;
     while ((iter = lua_rawiter(L, p_index, iter)) >= 0)
     {
@@ -35,7 +38,7 @@ bool gdluau::is_array(lua_State *L, int p_index)
             return false;
         }
 
-        if (static_cast<int>(num) != iter)
+        if (static_cast<int>(num) != ++count)
         {
             // Key found that doesn't sequentially count from 1
             return false;
@@ -62,7 +65,18 @@ Array gdluau::to_array(lua_State *L, int p_index, bool *r_is_array)
 
     ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 2), Array(), vformat("to_array(%d): Stack overflow. Cannot grow stack.", p_index));
 
+    // Sequences are held in the table's array part, so its length is usually the final size
+    int len = lua_objlen(L, p_index);
+
     Array arr;
+    arr.resize(len);
+
+    // Nested tables that refer back to this one are cycles, and convert to null
+    ConversionContext context;
+    context.begin(lua_topointer(L, p_index));
+    ConversionContext::DepthGuard depth_guard(context);
+
+    int count = 0;
     int iter = 0;
     bool is_array = true;
     while ((iter = lua_rawiter(L, p_index, iter)) >= 0)
@@ -70,19 +84,32 @@ Array gdluau::to_array(lua_State *L, int p_index, bool *r_is_array)
         int isnum;
         double num = lua_tonumberx(L, -2, &isnum);
 
-        if (!isnum || nearbyint(num) != num || static_cast<int>(num) != iter)
+        if (!isnum || nearbyint(num) != num || static_cast<int>(num) != count + 1)
         {
-            // Found non-array portion of the table
+            // Found non-array portion of the table (or a hole)
             is_array = false;
             lua_pop(L, 2); // Pop key and value
             break;
         }
 
-        Variant value = to_variant(L, -1);
-        arr.push_back(value);
+        if (count < len) [[likely]]
+        {
+            arr[count] = to_variant(L, -1, context);
+        }
+        else
+        {
+            arr.push_back(to_variant(L, -1, context));
+        }
+
+        count++;
         lua_pop(L, 2);
     }
 
+    if (count < len) [[unlikely]]
+    {
+        arr.resize(count);
+    }
+
     if (r_is_array)
     {
         *r_is_array = is_array;
@@ -91,14 +118,63 @@ Array gdluau::to_array(lua_State *L, int p_index, bool *r_is_array)
     return arr;
 }
 
+Array gdluau::to_array_typed(lua_State *L, int p_index, Variant::Type p_type, const StringName &p_class_name)
+{
+    Array arr;
+    arr.set_typed(p_type, p_class_name, Variant());
+
+    ERR_FAIL_COND_V_MSG(!is_valid_index(L, p_index), arr, vformat("to_array_typed(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
+
+    if (!lua_istable(L, p_index)) [[unlikely]]
+    {
+        // Not a table
+        return arr;
+    }
+
+    ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 1), arr, vformat("to_array_typed(%d): Stack overflow. Cannot grow stack.", p_index));
+
+    // Elements are written straight into the Array, so the reader is responsible for them matching its type
+    TypedElementReader reader = get_typed_element_reader(p_type);
+    bool check_class = p_type == Variant::OBJECT && !p_class_name.is_empty();
+
+    int len = lua_objlen(L, p_index);
+    arr.resize(len);
+
+    for (int i = 0; i < len; i++)
+    {
+        lua_rawgeti(L, p_index, i + 1); // Lua arrays are 1-based
+
+        Variant &element = arr[i];
+        bool valid = reader(L, -1, element);
+        if (valid && check_class)
+        {
+            Object *obj = element;
+            valid = obj == nullptr || obj->is_class(p_class_name);
+        }
+
+        lua_pop(L, 1);
+
+        if (!valid) [[unlikely]]
+        {
+            arr.clear();
+            ERR_FAIL_V_MSG(arr, vformat("to_array_typed(%d): Element %d can't be converted to %s.", p_index, i + 1, p_class_name.is_empty() ? Variant::get_type_name(p_type) : String(p_class_name)));
+        }
+    }
+
+    return arr;
+}
+
 void gdluau::push_array(lua_State *L, const Array &p_arr)
 {
     ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "LuaState.push_array(): Stack overflow. Cannot grow stack.");
 
-    lua_createtable(L, p_arr.size(), 0);
-    for (int i = 0; i < p_arr.size(); i++)
+    int size = static_cast<int>(p_arr.size());
+    TypedElementPusher pusher = get_typed_element_pusher(static_cast<Variant::Type>(p_arr.get_typed_builtin()));
+
+    lua_createtable(L, size, 0);
+    for (int i = 0; i < size; i++)
     {
-        push_variant(L, p_arr[i]);
+        pusher(L, p_arr[i]);
         lua_rawseti(L, -2, i + 1); // Lua arrays are 1-based
     }
 }
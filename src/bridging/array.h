@@ -1,6 +1,7 @@
 #pragma once
 
 #include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/variant.hpp>
 
 struct lua_State;
 
@@ -10,5 +11,12 @@ namespace gdluau
 
     bool is_array(lua_State *p_L, int p_index);
     Array to_array(lua_State *p_L, int p_index, bool *r_is_array = nullptr);
+
+    // Converts the sequence at p_index (up to its length) to an Array typed as p_type, converting each element
+    // straight to that type. For Variant::OBJECT, p_class_name optionally restricts the element class.
+    // Fails, returning an empty Array, if any element can't be converted.
+    Array to_array_typed(lua_State *p_L, int p_index, Variant::Type p_type, const StringName &p_class_name = StringName());
+
+    // Typed Arrays push their elements without checking each element's type
     void push_array(lua_State *p_L, const Array &p_arr);
 } // namespace gdluau
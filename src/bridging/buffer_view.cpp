@@ -0,0 +1,235 @@
+#include "bridging/buffer_view.h"
+
+#include "helpers.h"
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <lua.h>
+#include <lualib.h>
+
+#include <cstring>
+#include <type_traits>
+
+using namespace gdluau;
+using namespace godot;
+
+static const char *const BUFFER_VIEW_METATABLE_NAME = "GDBufferView";
+
+static void buffer_view_dtor(void *ud)
+{
+    PackedByteArray *bytes = static_cast<PackedByteArray *>(ud);
+    bytes->~PackedByteArray();
+}
+
+static PackedByteArray *check_buffer_view(lua_State *L, int p_index)
+{
+    return static_cast<PackedByteArray *>(luaL_checkudata(L, p_index, BUFFER_VIEW_METATABLE_NAME));
+}
+
+// Returns the offset at p_offset_index, raising an error unless [offset, offset + p_size) is within the view
+static int64_t check_range(lua_State *L, const PackedByteArray *p_bytes, int p_offset_index, int64_t p_size)
+{
+    int64_t offset = luaL_checkinteger(L, p_offset_index);
+    if (offset < 0 || p_size < 0 || offset + p_size > p_bytes->size()) [[unlikely]]
+    {
+        luaL_error(L, "buffer access out of bounds");
+    }
+
+    return offset;
+}
+
+// BufferView:read*(offset), matching the buffer library
+template <typename T>
+static int buffer_view_read(lua_State *L)
+{
+    const PackedByteArray *bytes = check_buffer_view(L, 1);
+    int64_t offset = check_range(L, bytes, 2, sizeof(T));
+
+    T value;
+    memcpy(&value, bytes->ptr() + offset, sizeof(T));
+
+    lua_pushnumber(L, static_cast<double>(value));
+    return 1;
+}
+
+// BufferView:write*(offset, value), matching the buffer library
+template <typename T>
+static int buffer_view_write(lua_State *L)
+{
+    PackedByteArray *bytes = check_buffer_view(L, 1);
+    int64_t offset = check_range(L, bytes, 2, sizeof(T));
+    double num = luaL_checknumber(L, 3);
+
+    T value;
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        value = static_cast<T>(num);
+    }
+    else
+    {
+        // Wrap out-of-range integers like the buffer library
+        value = static_cast<T>(static_cast<int64_t>(num));
+    }
+
+    // ptrw() detaches the view from any arrays it still shares data with
+    memcpy(bytes->ptrw() + offset, &value, sizeof(T));
+    return 0;
+}
+
+// BufferView:readstring(offset, count)
+static int buffer_view_readstring(lua_State *L)
+{
+    const PackedByteArray *bytes = check_buffer_view(L, 1);
+    int64_t count = luaL_checkinteger(L, 3);
+    int64_t offset = check_range(L, bytes, 2, count);
+
+    lua_pushlstring(L, reinterpret_cast<const char *>(bytes->ptr() + offset), count);
+    return 1;
+}
+
+// BufferView:writestring(offset, str, count?)
+static int buffer_view_writestring(lua_State *L)
+{
+    PackedByteArray *bytes = check_buffer_view(L, 1);
+
+    size_t len;
+    const char *str = luaL_checklstring(L, 3, &len);
+    int64_t count = luaL_optinteger(L, 4, static_cast<int>(len));
+    if (count < 0 || static_cast<size_t>(count) > len) [[unlikely]]
+    {
+        luaL_error(L, "string length overflow");
+    }
+
+    int64_t offset = check_range(L, bytes, 2, count);
+    memcpy(bytes->ptrw() + offset, str, count);
+    return 0;
+}
+
+// BufferView:fill(offset, value, count?)
+static int buffer_view_fill(lua_State *L)
+{
+    PackedByteArray *bytes = check_buffer_view(L, 1);
+    int64_t offset = luaL_checkinteger(L, 2);
+    uint8_t value = static_cast<uint8_t>(luaL_checkinteger(L, 3));
+    int64_t count = luaL_optinteger(L, 4, static_cast<int>(bytes->size() - offset));
+
+    check_range(L, bytes, 2, count);
+    memset(bytes->ptrw() + offset, value, count);
+    return 0;
+}
+
+// BufferView:len()
+static int buffer_view_len(lua_State *L)
+{
+    const PackedByteArray *bytes = check_buffer_view(L, 1);
+    lua_pushnumber(L, static_cast<double>(bytes->size()));
+    return 1;
+}
+
+// BufferView:tostring(), copying the whole contents into a string
+static int buffer_view_tostring_contents(lua_State *L)
+{
+    const PackedByteArray *bytes = check_buffer_view(L, 1);
+    lua_pushlstring(L, reinterpret_cast<const char *>(bytes->ptr()), bytes->size());
+    return 1;
+}
+
+// BufferView:tobuffer(), copying the whole contents into a Luau buffer
+static int buffer_view_tobuffer(lua_State *L)
+{
+    const PackedByteArray *bytes = check_buffer_view(L, 1);
+    void *buf = lua_newbuffer(L, bytes->size());
+    memcpy(buf, bytes->ptr(), bytes->size());
+    return 1;
+}
+
+// BufferView.__tostring metamethod
+static int buffer_view_tostring(lua_State *L)
+{
+    const PackedByteArray *bytes = check_buffer_view(L, 1);
+    lua_pushfstring(L, "BufferView: %d bytes", static_cast<int>(bytes->size()));
+    return 1;
+}
+
+static const luaL_Reg buffer_view_methods[] = {
+    {"readi8", buffer_view_read<int8_t>},
+    {"readu8", buffer_view_read<uint8_t>},
+    {"readi16", buffer_view_read<int16_t>},
+    {"readu16", buffer_view_read<uint16_t>},
+    {"readi32", buffer_view_read<int32_t>},
+    {"readu32", buffer_view_read<uint32_t>},
+    {"readf32", buffer_view_read<float>},
+    {"readf64", buffer_view_read<double>},
+    {"writei8", buffer_view_write<int8_t>},
+    {"writeu8", buffer_view_write<uint8_t>},
+    {"writei16", buffer_view_write<int16_t>},
+    {"writeu16", buffer_view_write<uint16_t>},
+    {"writei32", buffer_view_write<int32_t>},
+    {"writeu32", buffer_view_write<uint32_t>},
+    {"writef32", buffer_view_write<float>},
+    {"writef64", buffer_view_write<double>},
+    {"readstring", buffer_view_readstring},
+    {"writestring", buffer_view_writestring},
+    {"fill", buffer_view_fill},
+    {"len", buffer_view_len},
+    {"tostring", buffer_view_tostring_contents},
+    {"tobuffer", buffer_view_tobuffer},
+    {nullptr, nullptr},
+};
+
+static void push_buffer_view_metatable(lua_State *L)
+{
+    if (!luaL_newmetatable(L, BUFFER_VIEW_METATABLE_NAME)) [[likely]]
+    {
+        // Metatable already configured
+        return;
+    }
+
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "push_buffer_view_metatable(): Stack overflow. Cannot grow stack.");
+
+    lua_createtable(L, 0, sizeof(buffer_view_methods) / sizeof(buffer_view_methods[0]) - 1);
+    luaL_register(L, nullptr, buffer_view_methods);
+    lua_setreadonly(L, -1, 1);
+    lua_setfield(L, -2, "__index");
+
+    lua_pushcfunction(L, buffer_view_len, "BufferView.__len");
+    lua_setfield(L, -2, "__len");
+
+    lua_pushcfunction(L, buffer_view_tostring, "BufferView.__tostring");
+    lua_setfield(L, -2, "__tostring");
+
+    // Packed byte arrays are otherwise pushed as buffers, so this type only identifies buffer views
+    register_native_userdata_metatable(L, Variant::PACKED_BYTE_ARRAY);
+
+    // Freeze metatable
+    lua_setreadonly(L, -1, 1);
+}
+
+bool gdluau::is_buffer_view(lua_State *L, int p_index)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid_index(L, p_index), false, vformat("is_buffer_view(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
+
+    return get_native_userdata_type(L, p_index) == Variant::PACKED_BYTE_ARRAY;
+}
+
+PackedByteArray *gdluau::to_buffer_view(lua_State *L, int p_index)
+{
+    if (!is_buffer_view(L, p_index))
+    {
+        return nullptr;
+    }
+
+    return static_cast<PackedByteArray *>(lua_touserdata(L, p_index));
+}
+
+void gdluau::push_buffer_view(lua_State *L, const PackedByteArray &p_bytes)
+{
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "push_buffer_view(): Stack overflow. Cannot grow stack."); // View + metatable
+
+    // Copying the PackedByteArray only takes a reference to its data
+    void *ud = lua_newuserdatadtor(L, sizeof(PackedByteArray), buffer_view_dtor);
+    memnew_placement(ud, PackedByteArray(p_bytes));
+
+    push_buffer_view_metatable(L);
+    lua_setmetatable(L, -2);
+}
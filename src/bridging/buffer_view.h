@@ -0,0 +1,20 @@
+#pragma once
+
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+struct lua_State;
+
+namespace gdluau
+{
+    using namespace godot;
+
+    // Buffer views are userdata wrapping a PackedByteArray, which Lua can read without
+    // copying. The array is shared with Godot until a script writes to it, at which
+    // point the usual copy-on-write semantics of Packed*Array give the view its own copy.
+    //
+    // The view metatable is registered with register_native_userdata_metatable() as
+    // PACKED_BYTE_ARRAY, which is how to_variant() reads the shared array back.
+    bool is_buffer_view(lua_State *p_L, int p_index);
+    PackedByteArray *to_buffer_view(lua_State *p_L, int p_index);
+    void push_buffer_view(lua_State *p_L, const PackedByteArray &p_bytes);
+} // namespace gdluau
@@ -3,6 +3,7 @@
 #include "bridging/variant.h"
 #include "helpers.h"
 #include "lua_state.h"
+#include "static_strings.h"
 
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/memory.hpp>
@@ -15,17 +16,24 @@ using namespace godot;
 
 static const char *const CALLABLE_METATABLE_NAME = "GDCallable";
 
+// Userdata payload for Godot Callables pushed to Lua
+struct CallableUserdata
+{
+    Callable callable;
+    bool bound_state; // Callable is a LuaStateBoundCallable, which takes the LuaState as its first argument
+};
+
 static void callable_dtor(void *ud)
 {
-    Callable *callable = static_cast<Callable *>(ud);
-    callable->~Callable();
+    CallableUserdata *data = static_cast<CallableUserdata *>(ud);
+    data->~CallableUserdata();
 }
 
 // Callable.__tostring metamethod
 static int callable_tostring(lua_State *L)
 {
-    Callable *callable = static_cast<Callable *>(lua_touserdata(L, 1));
-    String str = Variant(*callable).stringify();
+    CallableUserdata *data = static_cast<CallableUserdata *>(lua_touserdata(L, 1));
+    String str = Variant(data->callable).stringify();
     lua_pop(L, 1);
 
     CharString utf8 = str.utf8();
@@ -36,11 +44,12 @@ static int callable_tostring(lua_State *L)
 // Callable.__eq metamethod
 static int callable_eq(lua_State *L)
 {
-    Callable a = *static_cast<Callable *>(lua_touserdata(L, 1));
-    Callable b = *static_cast<Callable *>(lua_touserdata(L, 2));
+    CallableUserdata *a = static_cast<CallableUserdata *>(lua_touserdata(L, 1));
+    CallableUserdata *b = static_cast<CallableUserdata *>(lua_touserdata(L, 2));
+    bool equal = a->callable == b->callable;
     lua_pop(L, 2);
 
-    lua_pushboolean(L, a == b);
+    lua_pushboolean(L, equal);
     return 1;
 }
 
@@ -48,43 +57,62 @@ static int callable_eq(lua_State *L)
 static int callable_call(lua_State *L)
 {
     // First argument on the stack is the object being called
-    Callable callable = *static_cast<Callable *>(lua_touserdata(L, 1));
-    if (!callable.is_valid()) [[unlikely]]
+    CallableUserdata *data = static_cast<CallableUserdata *>(lua_touserdata(L, 1));
+    if (!data->callable.is_valid()) [[unlikely]]
     {
         luaL_argerror(L, 1, "Callable is not valid");
     }
 
     int arg_count = lua_gettop(L) - 1; // Subtract 1 for self
-    int expected_args = callable.get_argument_count();
-    int luastate_arg = callable.is_custom() && dynamic_cast<LuaStateBoundCallable *>(callable.get_custom());
+    int expected_args = data->callable.get_argument_count();
+    int luastate_arg = data->bound_state ? 1 : 0;
     if (expected_args >= 0 && arg_count + luastate_arg < expected_args) [[unlikely]]
     {
         luaL_error(L, "Too few arguments for Callable (expected at least %d, got %d)", expected_args, arg_count);
     }
 
-    Array args;
-    args.resize(arg_count + luastate_arg);
-    if (luastate_arg)
-    {
-        args[0] = LuaState::find_or_create_lua_state(L);
-    }
+    bool success = true;
+    int additional_returns = 0;
 
-    for (int argi = 0; argi < arg_count; argi++)
+    // Scoped so that destructors run before any lua_error longjmp
     {
+        Variant luastate;
+        if (luastate_arg)
+        {
+            luastate = LuaState::find_or_create_lua_state(L);
+        }
+
         // Skip `self` at index 1 (Lua stack is 1-based)
-        int stack_idx = argi + 2;
-        args[argi + luastate_arg] = to_variant(L, stack_idx);
-    }
+        StackVariantArgs args(L, 2, arg_count, luastate_arg ? &luastate : nullptr);
+        Variant self(data->callable);
+
+        // Pop all arguments and `self` from the stack
+        lua_pop(L, arg_count + 1);
 
-    // Pop all arguments and `self` from the stack
-    lua_pop(L, arg_count + 1);
+        Variant result;
+        GDExtensionCallError error;
+        self.callp(static_strings->call, args.ptrs(), args.size(), result, error);
 
-    Variant result = callable.callv(args);
+        if (error.error != GDEXTENSION_CALL_OK) [[unlikely]]
+        {
+            CharString error_msg = describe_call_error(self.stringify(), error).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+            success = false;
+        }
+        else
+        {
+            // The Callable can return additional values by pushing them on the stack
+            additional_returns = lua_gettop(L);
 
-    // The Callable can return additional values by pushing them on the stack
-    int additional_returns = lua_gettop(L);
+            push_variant(L, result);
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
 
-    push_variant(L, result);
     return 1 + additional_returns;
 }
 
@@ -129,7 +157,7 @@ bool gdluau::is_godot_callable(lua_State *L, int p_index)
     return mt_equal;
 }
 
-Callable gdluau::to_callable(lua_State *L, int p_index)
+Callable gdluau::to_callable(lua_State *L, int p_index, bool p_multiple_returns)
 {
     ERR_FAIL_COND_V_MSG(!is_valid_index(L, p_index), Callable(), vformat("to_callable(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
 
@@ -143,8 +171,8 @@ Callable gdluau::to_callable(lua_State *L, int p_index)
     // If so, return the original Callable instead of wrapping it again
     if (is_godot_callable(L, p_index))
     {
-        Callable *callable = static_cast<Callable *>(lua_touserdata(L, p_index));
-        return *callable;
+        CallableUserdata *data = static_cast<CallableUserdata *>(lua_touserdata(L, p_index));
+        return data->callable;
     }
 
     // Protect the value from GC
@@ -153,7 +181,7 @@ Callable gdluau::to_callable(lua_State *L, int p_index)
     LuaState *state = LuaState::find_lua_state(L);
     ERR_FAIL_COND_V_MSG(!state, Callable(), "to_callable(): Could not find existing LuaState for the given lua_State.");
 
-    LuaCallable *lc = memnew(LuaCallable(state, value_ref));
+    LuaCallable *lc = memnew(LuaCallable(state, value_ref, type == LUA_TFUNCTION, p_multiple_returns));
     return Callable(lc);
 }
 
@@ -177,16 +205,19 @@ void gdluau::push_callable(lua_State *L, const Callable &p_callable)
     }
 
     // Use of an inline dtor is REQUIRED to not conflict with user's custom userdata tags
-    void *ptr = lua_newuserdatadtor(L, sizeof(Callable), callable_dtor);
-    memnew_placement(ptr, Callable(p_callable));
+    void *ptr = lua_newuserdatadtor(L, sizeof(CallableUserdata), callable_dtor);
+    CallableUserdata *data = memnew_placement(ptr, CallableUserdata);
+    data->callable = p_callable;
+    data->bound_state = p_callable.is_custom() && dynamic_cast<LuaStateBoundCallable *>(p_callable.get_custom()) != nullptr;
 
     push_callable_metatable(L);
     lua_setmetatable(L, -2);
 }
 
-LuaCallable::LuaCallable(LuaState *p_state, int p_lua_ref)
-    : lua_state_id(p_state->get_instance_id()), lua_ref(p_lua_ref)
+LuaCallable::LuaCallable(LuaState *p_state, int p_lua_ref, bool p_is_function, bool p_multiple_returns)
+    : lua_state_id(p_state->get_instance_id()), lua_state(p_state), lua_state_token(p_state->get_token()), lua_ref(p_lua_ref), is_function(p_is_function), multiple_returns(p_multiple_returns)
 {
+    lua_state_token->reference();
 }
 
 LuaCallable::~LuaCallable()
@@ -198,6 +229,8 @@ LuaCallable::~LuaCallable()
     {
         state->unref(lua_ref);
     }
+
+    lua_state_token->unreference();
 }
 
 bool LuaCallable::get_func_info(const char *p_what, lua_Debug &r_ar) const
@@ -355,42 +388,36 @@ void LuaCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_r
         return;
     }
 
-    // Referenced value + all arguments
-    if (!lua_checkstack(L, 1 + p_argcount)) [[unlikely]]
+    // Function + `self` + all arguments
+    if (!lua_checkstack(L, 2 + p_argcount)) [[unlikely]]
     {
         ERR_PRINT(vformat("LuaCallable.call(): Stack overflow. Cannot grow stack for %d arguments.", p_argcount));
         r_call_error.error = GDEXTENSION_CALL_ERROR_TOO_MANY_ARGUMENTS;
         return;
     }
 
-    int type = lua_getref(L, lua_ref);
+    int base = lua_gettop(L);
     int self_arg = 0;
-    switch (type)
+    if (is_function) [[likely]]
     {
-    case LUA_TFUNCTION:
-        // Functions are directly callable, nothing to do
-        break;
-
-    case LUA_TUSERDATA:
-        [[fallthrough]];
-    case LUA_TTABLE:
-        if (!get_func_from_callable_table_or_userdata(L))
+        lua_getref(L, lua_ref);
+    }
+    else
+    {
+        // The userdata/table becomes the `self` arg. __call is resolved on every call rather than cached: for the
+        // usual single __call function that is one metatable read and one field lookup, which is no more than
+        // checking a cached target would cost, and a cache would have to check every link of a nested chain.
+        int type = lua_getref(L, lua_ref);
+        if ((type != LUA_TUSERDATA && type != LUA_TTABLE) || !get_func_from_callable_table_or_userdata(L))
         {
             ERR_PRINT(vformat("LuaCallable.call(): Expected userdata or table %s to have a __call metamethod", get_as_text()));
-            lua_pop(L, 1);
+            lua_settop(L, base);
             r_call_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
             return;
         }
 
-        lua_insert(L, -2); // Move function below userdata/table (which becomes the `self` arg)
+        lua_insert(L, -2); // The function goes below `self`
         self_arg = 1;
-        break;
-
-    default:
-        ERR_PRINT(vformat("LuaCallable.call(): Expected function, userdata, or table, got %s.", lua_typename(L, type)));
-        lua_pop(L, 1);
-        r_call_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
-        return;
     }
 
     for (int i = 0; i < p_argcount; i++)
@@ -398,19 +425,40 @@ void LuaCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_r
         push_variant(L, *(p_arguments[i]));
     }
 
-    int status = lua_pcall(L, self_arg + p_argcount, 1, 0);
+    int status = lua_pcall(L, self_arg + p_argcount, multiple_returns ? LUA_MULTRET : 1, 0);
     if (status != LUA_OK)
     {
         const char *error_msg = lua_tostring(L, -1);
         ERR_PRINT(vformat("LuaCallable.call(): error during call to %s: %s", get_as_text(), error_msg));
-        lua_pop(L, 1);
+        lua_settop(L, base);
 
         // Don't set r_call_error, to avoid a fatal script error.
+        if (multiple_returns)
+        {
+            r_return_value = Array();
+        }
         return;
     }
 
-    r_return_value = to_variant(L, -1);
-    lua_pop(L, 1);
+    if (!multiple_returns) [[likely]]
+    {
+        r_return_value = to_variant(L, -1);
+        lua_settop(L, base);
+        return;
+    }
+
+    int result_count = lua_gettop(L) - base;
+    Array results;
+    results.resize(result_count);
+
+    ConversionContext ctx;
+    for (int i = 0; i < result_count; i++)
+    {
+        results[i] = to_variant(L, base + 1 + i, ctx);
+    }
+
+    lua_settop(L, base);
+    r_return_value = results;
 }
 
 bool LuaCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b)
@@ -435,8 +483,7 @@ bool LuaCallable::compare_less(const CallableCustom *p_a, const CallableCustom *
 
 LuaState *LuaCallable::get_lua_state() const
 {
-    Object *obj = ObjectDB::get_instance(lua_state_id);
-    return Object::cast_to<LuaState>(obj);
+    return lua_state_token->is_closed() ? nullptr : lua_state;
 }
 
 int LuaCallable::get_lua_ref() const
@@ -444,6 +491,11 @@ int LuaCallable::get_lua_ref() const
     return lua_ref;
 }
 
+bool LuaCallable::has_multiple_returns() const
+{
+    return multiple_returns;
+}
+
 uint32_t LuaStateBoundCallable::hash() const
 {
     uint32_t h = HASH_MURMUR3_SEED;
@@ -11,23 +11,28 @@ namespace gdluau
     using namespace godot;
 
     class LuaState;
+    class LuaStateToken;
 
     bool is_godot_callable(lua_State *p_L, int p_index);
-    Callable to_callable(lua_State *p_L, int p_index);
+    Callable to_callable(lua_State *p_L, int p_index, bool p_multiple_returns = false);
     void push_callable(lua_State *p_L, const Callable &p_callable);
 
     // Custom Callable that wraps a Lua function, or a value with a __call metamethod.
     class LuaCallable : public CallableCustom
     {
     private:
-        ObjectID lua_state_id; // Weak reference to LuaState
-        int lua_ref;           // Reference to Lua value in registry
+        ObjectID lua_state_id;            // Identity of the LuaState, for hashing and comparison
+        LuaState *lua_state;              // Weak reference to LuaState, only valid while lua_state_token is open
+        LuaStateToken *lua_state_token;   // Shared with the LuaState, so liveness can be checked without ObjectDB
+        int lua_ref;                      // Reference to Lua value in registry
+        bool is_function;                 // Value is a plain function, called without resolving __call
+        bool multiple_returns;            // Return all results as an Array instead of only the first
 
         bool get_func_info(const char *p_what, lua_Debug &r_ar) const;
         bool get_func_from_callable_table_or_userdata(lua_State *L) const;
 
     public:
-        LuaCallable(LuaState *p_state, int p_lua_ref);
+        LuaCallable(LuaState *p_state, int p_lua_ref, bool p_is_function, bool p_multiple_returns = false);
         ~LuaCallable();
 
         // CallableCustom interface
@@ -46,6 +51,7 @@ namespace gdluau
 
         LuaState *get_lua_state() const;
         int get_lua_ref() const;
+        bool has_multiple_returns() const;
     };
 
     class LuaStateBoundCallable : public CallableCustom
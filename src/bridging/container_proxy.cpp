@@ -0,0 +1,470 @@
+#include "bridging/container_proxy.h"
+
+#include "bridging/typed_element.h"
+#include "bridging/variant.h"
+#include "helpers.h"
+#include "string_cache.h"
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+#include <lua.h>
+#include <lualib.h>
+
+#include <type_traits>
+
+using namespace gdluau;
+using namespace godot;
+
+static const char *const ARRAY_PROXY_METATABLE_NAME = "GDArrayProxy";
+static const char *const DICTIONARY_PROXY_METATABLE_NAME = "GDDictionaryProxy";
+static const char *const DICTIONARY_PROXY_ITERATOR_METATABLE_NAME = "GDDictionaryProxyIterator";
+
+template <typename TContainer>
+constexpr const char *CONTAINER_PROXY_METATABLE_NAME = nullptr;
+template <>
+constexpr const char *CONTAINER_PROXY_METATABLE_NAME<Array> = ARRAY_PROXY_METATABLE_NAME;
+template <>
+constexpr const char *CONTAINER_PROXY_METATABLE_NAME<Dictionary> = DICTIONARY_PROXY_METATABLE_NAME;
+
+template <typename TContainer>
+constexpr Variant::Type CONTAINER_VARIANT_TYPE = Variant::NIL;
+template <>
+constexpr Variant::Type CONTAINER_VARIANT_TYPE<Array> = Variant::ARRAY;
+template <>
+constexpr Variant::Type CONTAINER_VARIANT_TYPE<Dictionary> = Variant::DICTIONARY;
+
+template <typename TContainer>
+static void container_proxy_dtor(void *ud)
+{
+    TContainer *container = static_cast<TContainer *>(ud);
+    container->~TContainer();
+}
+
+template <typename TContainer>
+static TContainer *check_container_proxy(lua_State *L, int p_index)
+{
+    return static_cast<TContainer *>(luaL_checkudata(L, p_index, CONTAINER_PROXY_METATABLE_NAME<TContainer>));
+}
+
+// Reads the value at p_index as an element of a container typed as p_type. If it can't be converted, pushes an
+// error message and returns false, so that the caller can raise it once its own C++ locals are out of scope.
+static bool read_element(lua_State *L, int p_index, Variant::Type p_type, Variant &r_value, const char *p_what)
+{
+    if (get_typed_element_reader(p_type)(L, p_index, r_value)) [[likely]]
+    {
+        return true;
+    }
+
+    CharString type_name = Variant::get_type_name(p_type).utf8();
+    lua_pushfstring(L, "cannot use %s as %s of type %s", luaL_typename(L, p_index), p_what, type_name.get_data());
+    return false;
+}
+
+// Array proxies
+
+// ArrayProxy.__index metamethod. Like a table, indices are 1-based and out of range reads are nil.
+static int array_proxy_index(lua_State *L)
+{
+    const Array *arr = check_container_proxy<Array>(L, 1);
+
+    int isnum;
+    double num = lua_tonumberx(L, 2, &isnum);
+    int64_t index = static_cast<int64_t>(num) - 1;
+    if (!isnum || index < 0 || index >= arr->size() || static_cast<double>(index + 1) != num) [[unlikely]]
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    push_variant_proxy(L, (*arr)[index]);
+    return 1;
+}
+
+// ArrayProxy.__newindex metamethod, writing into the shared Array. Assigning to #arr + 1 appends.
+static int array_proxy_newindex(lua_State *L)
+{
+    Array *arr = check_container_proxy<Array>(L, 1);
+    if (arr->is_read_only()) [[unlikely]]
+    {
+        luaL_error(L, "array is read-only");
+    }
+
+    int64_t size = arr->size();
+    double num = luaL_checknumber(L, 2);
+    int64_t index = static_cast<int64_t>(num) - 1;
+    if (index < 0 || index > size || static_cast<double>(index + 1) != num) [[unlikely]]
+    {
+        luaL_error(L, "index %s out of range for array of size %d", lua_tostring(L, 2), static_cast<int>(size));
+    }
+
+    bool success;
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        // Typed arrays convert the value to their element type first, where Array::set() would only reject it
+        Variant value;
+        success = read_element(L, 3, static_cast<Variant::Type>(arr->get_typed_builtin()), value, "an element");
+        if (success && index == size)
+        {
+            arr->push_back(value);
+        }
+        else if (success)
+        {
+            arr->set(index, value);
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
+
+    return 0;
+}
+
+// ArrayProxy.__len metamethod
+static int array_proxy_len(lua_State *L)
+{
+    const Array *arr = check_container_proxy<Array>(L, 1);
+    lua_pushnumber(L, static_cast<double>(arr->size()));
+    return 1;
+}
+
+// Iterator function returned from ArrayProxy.__iter, yielding (index, element) pairs.
+// The control variable is the previous 1-based index, starting at 0.
+static int array_proxy_next(lua_State *L)
+{
+    const Array *arr = check_container_proxy<Array>(L, 1);
+    int64_t index = static_cast<int64_t>(luaL_checknumber(L, 2));
+    if (index >= arr->size())
+    {
+        return 0;
+    }
+
+    lua_pushnumber(L, static_cast<double>(index + 1));
+    push_variant_proxy(L, (*arr)[index]);
+    return 2;
+}
+
+// ArrayProxy.__iter metamethod, which doesn't allocate an iterator closure
+static int array_proxy_iter(lua_State *L)
+{
+    check_container_proxy<Array>(L, 1);
+    lua_settop(L, 1);
+
+    lua_pushcfunction(L, array_proxy_next, "ArrayProxy.__iter.next");
+    lua_insert(L, 1);
+    lua_pushnumber(L, 0);
+    return 3;
+}
+
+// Dictionary proxies
+
+// DictionaryProxy.__index metamethod. Like a table, missing keys read as nil.
+static int dictionary_proxy_index(lua_State *L)
+{
+    const Dictionary *dict = check_container_proxy<Dictionary>(L, 1);
+
+    // Keys of typed Dictionaries are converted to the key type, e.g. strings to StringNames
+    Variant key;
+    if (get_typed_element_reader(static_cast<Variant::Type>(dict->get_typed_key_builtin()))(L, 2, key)) [[likely]]
+    {
+        push_variant_proxy(L, dict->get(key, Variant()));
+    }
+    else
+    {
+        lua_pushnil(L);
+    }
+
+    return 1;
+}
+
+// DictionaryProxy.__newindex metamethod, writing into the shared Dictionary. Assigning nil erases the key.
+static int dictionary_proxy_newindex(lua_State *L)
+{
+    Dictionary *dict = check_container_proxy<Dictionary>(L, 1);
+    if (dict->is_read_only()) [[unlikely]]
+    {
+        luaL_error(L, "dictionary is read-only");
+    }
+
+    bool success;
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        Variant key;
+        success = read_element(L, 2, static_cast<Variant::Type>(dict->get_typed_key_builtin()), key, "a key");
+
+        if (success && lua_isnil(L, 3))
+        {
+            dict->erase(key);
+        }
+        else if (success)
+        {
+            Variant value;
+            success = read_element(L, 3, static_cast<Variant::Type>(dict->get_typed_value_builtin()), value, "a value");
+            if (success)
+            {
+                dict->set(key, value);
+            }
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
+
+    return 0;
+}
+
+// DictionaryProxy.__len metamethod, which is the number of entries
+static int dictionary_proxy_len(lua_State *L)
+{
+    const Dictionary *dict = check_container_proxy<Dictionary>(L, 1);
+    lua_pushnumber(L, static_cast<double>(dict->size()));
+    return 1;
+}
+
+// Iteration state for DictionaryProxy.__iter. Keys are kept as Variants, rather than being
+// converted back from Lua each step, so that they always match the Dictionary's own keys.
+struct DictionaryProxyIterator
+{
+    Variant dict;
+    Variant key;
+    bool started = false;
+};
+
+static void dictionary_proxy_iterator_dtor(void *ud)
+{
+    DictionaryProxyIterator *it = static_cast<DictionaryProxyIterator *>(ud);
+    it->~DictionaryProxyIterator();
+}
+
+// Iterator function returned from DictionaryProxy.__iter, yielding (key, value) pairs.
+// As for tables, iteration ends at a nil key.
+static int dictionary_proxy_next(lua_State *L)
+{
+    DictionaryProxyIterator *it = static_cast<DictionaryProxyIterator *>(luaL_checkudata(L, 1, DICTIONARY_PROXY_ITERATOR_METATABLE_NAME));
+
+    bool valid;
+    bool has_next = it->started ? it->dict.iter_next(it->key, valid) : it->dict.iter_init(it->key, valid);
+    it->started = true;
+
+    if (!has_next)
+    {
+        return 0;
+    }
+
+    push_variant_proxy(L, it->key);
+    push_variant_proxy(L, it->dict.get(it->key));
+    return 2;
+}
+
+// DictionaryProxy.__iter metamethod
+static int dictionary_proxy_iter(lua_State *L)
+{
+    const Dictionary *dict = check_container_proxy<Dictionary>(L, 1);
+
+    lua_pushcfunction(L, dictionary_proxy_next, "DictionaryProxy.__iter.next");
+
+    void *ud = lua_newuserdatadtor(L, sizeof(DictionaryProxyIterator), dictionary_proxy_iterator_dtor);
+    DictionaryProxyIterator *it = memnew_placement(ud, DictionaryProxyIterator);
+    it->dict = *dict;
+
+    if (luaL_newmetatable(L, DICTIONARY_PROXY_ITERATOR_METATABLE_NAME))
+    {
+        lua_setreadonly(L, -1, 1);
+    }
+    lua_setmetatable(L, -2);
+
+    lua_pushnil(L);
+    return 3;
+}
+
+// Shared metamethods
+
+// __namecall metamethod, for proxy:method(...) syntax. Methods act on the shared container.
+template <typename TContainer>
+static int container_proxy_namecall(lua_State *L)
+{
+    int atom = -1;
+    const char *name = lua_namecallatom(L, &atom);
+    if (!name) [[unlikely]]
+    {
+        luaL_error(L, "ContainerProxy.__namecall: method name not available");
+    }
+
+    TContainer *container = check_container_proxy<TContainer>(L, 1);
+    int arg_count = lua_gettop(L) - 1;
+    bool success = true;
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        StringName method = string_name_for_atom(atom);
+        if (method.is_empty())
+        {
+            method = StringName(String::utf8(name));
+        }
+
+        StackVariantArgs args(L, 2, arg_count);
+
+        // Arrays and Dictionaries are references, so the Variant shares the container
+        Variant self = *container;
+
+        Variant result;
+        GDExtensionCallError error;
+        self.callp(method, args.ptrs(), args.size(), result, error);
+
+        if (error.error != GDEXTENSION_CALL_OK) [[unlikely]]
+        {
+            CharString error_msg = describe_call_error(vformat("%s.%s", Variant::get_type_name(CONTAINER_VARIANT_TYPE<TContainer>), method), error).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+            success = false;
+        }
+        else
+        {
+            push_variant_proxy(L, result);
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
+
+    return 1;
+}
+
+// __tostring metamethod
+template <typename TContainer>
+static int container_proxy_tostring(lua_State *L)
+{
+    const TContainer *container = check_container_proxy<TContainer>(L, 1);
+    CharString utf8 = Variant(*container).stringify().utf8();
+
+    lua_pushlstring(L, utf8.get_data(), utf8.length());
+    return 1;
+}
+
+// __eq metamethod. Proxies are equal if they wrap the same container.
+template <typename TContainer>
+static int container_proxy_eq(lua_State *L)
+{
+    const TContainer *a = check_container_proxy<TContainer>(L, 1);
+    const TContainer *b = check_container_proxy<TContainer>(L, 2);
+
+    lua_pushboolean(L, UtilityFunctions::is_same(*a, *b));
+    return 1;
+}
+
+template <typename TContainer>
+static void push_container_proxy_metatable(lua_State *L)
+{
+    if (!luaL_newmetatable(L, CONTAINER_PROXY_METATABLE_NAME<TContainer>)) [[likely]]
+    {
+        // Metatable already configured
+        return;
+    }
+
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "push_container_proxy_metatable(): Stack overflow. Cannot grow stack.");
+
+    if constexpr (std::is_same_v<TContainer, Array>)
+    {
+        lua_pushcfunction(L, array_proxy_index, "ArrayProxy.__index");
+        lua_setfield(L, -2, "__index");
+
+        lua_pushcfunction(L, array_proxy_newindex, "ArrayProxy.__newindex");
+        lua_setfield(L, -2, "__newindex");
+
+        lua_pushcfunction(L, array_proxy_len, "ArrayProxy.__len");
+        lua_setfield(L, -2, "__len");
+
+        lua_pushcfunction(L, array_proxy_iter, "ArrayProxy.__iter");
+        lua_setfield(L, -2, "__iter");
+    }
+    else
+    {
+        lua_pushcfunction(L, dictionary_proxy_index, "DictionaryProxy.__index");
+        lua_setfield(L, -2, "__index");
+
+        lua_pushcfunction(L, dictionary_proxy_newindex, "DictionaryProxy.__newindex");
+        lua_setfield(L, -2, "__newindex");
+
+        lua_pushcfunction(L, dictionary_proxy_len, "DictionaryProxy.__len");
+        lua_setfield(L, -2, "__len");
+
+        lua_pushcfunction(L, dictionary_proxy_iter, "DictionaryProxy.__iter");
+        lua_setfield(L, -2, "__iter");
+    }
+
+    lua_pushcfunction(L, container_proxy_namecall<TContainer>, "ContainerProxy.__namecall");
+    lua_setfield(L, -2, "__namecall");
+
+    lua_pushcfunction(L, container_proxy_tostring<TContainer>, "ContainerProxy.__tostring");
+    lua_setfield(L, -2, "__tostring");
+
+    lua_pushcfunction(L, container_proxy_eq<TContainer>, "ContainerProxy.__eq");
+    lua_setfield(L, -2, "__eq");
+
+    register_native_userdata_metatable(L, std::is_same_v<TContainer, Array> ? Variant::ARRAY : Variant::DICTIONARY);
+
+    // Freeze metatable
+    lua_setreadonly(L, -1, 1);
+}
+
+template <typename TContainer>
+static void push_container_proxy(lua_State *L, const TContainer &p_container)
+{
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "push_container_proxy(): Stack overflow. Cannot grow stack."); // Proxy + metatable
+
+    // Copying the container only takes a reference to it
+    void *ud = lua_newuserdatadtor(L, sizeof(TContainer), container_proxy_dtor<TContainer>);
+    memnew_placement(ud, TContainer(p_container));
+
+    push_container_proxy_metatable<TContainer>(L);
+    lua_setmetatable(L, -2);
+}
+
+bool gdluau::is_container_proxy(lua_State *L, int p_index)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid_index(L, p_index), false, vformat("is_container_proxy(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
+
+    Variant::Type type = get_native_userdata_type(L, p_index);
+    return type == Variant::ARRAY || type == Variant::DICTIONARY;
+}
+
+void gdluau::push_array_proxy(lua_State *L, const Array &p_arr)
+{
+    push_container_proxy(L, p_arr);
+}
+
+void gdluau::push_dictionary_proxy(lua_State *L, const Dictionary &p_dict)
+{
+    push_container_proxy(L, p_dict);
+}
+
+void gdluau::push_variant_proxy(lua_State *L, const Variant &p_value)
+{
+    switch (p_value.get_type())
+    {
+    case Variant::ARRAY:
+    {
+        Array arr = p_value;
+        push_array_proxy(L, arr);
+        return;
+    }
+
+    case Variant::DICTIONARY:
+    {
+        Dictionary dict = p_value;
+        push_dictionary_proxy(L, dict);
+        return;
+    }
+
+    default:
+        push_variant(L, p_value);
+        return;
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+struct lua_State;
+
+namespace gdluau
+{
+    using namespace godot;
+
+    // Container proxies are userdata wrapping an Array or Dictionary, which Lua reads and writes
+    // through on demand instead of copying the whole container into a table. The container is
+    // shared, so writes from either side are visible to the other.
+    //
+    // From Lua, proxies behave like the tables push_array/push_dictionary would produce: arrays
+    // are indexed from 1, #proxy is the size, and `for k, v in proxy` iterates without copying.
+    // Assigning one past the end of an array appends to it, and assigning nil to a Dictionary
+    // key erases it. Godot methods are available with proxy:method(...). Nested Arrays and
+    // Dictionaries are proxied as they are read.
+    //
+    // Proxy metatables are registered with register_native_userdata_metatable(), which is how
+    // to_variant() reads the shared container back.
+    bool is_container_proxy(lua_State *p_L, int p_index);
+    void push_array_proxy(lua_State *p_L, const Array &p_arr);
+    void push_dictionary_proxy(lua_State *p_L, const Dictionary &p_dict);
+
+    // Pushes Arrays and Dictionaries as proxies, and any other value as push_variant() does
+    void push_variant_proxy(lua_State *p_L, const Variant &p_value);
+} // namespace gdluau
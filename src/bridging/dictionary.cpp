@@ -1,4 +1,5 @@
 #include "bridging/dictionary.h"
+#include "bridging/typed_element.h"
 #include "bridging/variant.h"
 #include "helpers.h"
 
@@ -26,12 +27,19 @@ Dictionary gdluau::to_dictionary(lua_State *L, int p_index, bool *r_success)
 
     ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 2), Dictionary(), vformat("to_dictionary(%d): Stack overflow. Cannot grow stack.", p_index));
 
+    // Dictionaries can't reserve capacity through the extension API, so they are filled directly
     Dictionary dict;
+
+    // Nested tables that refer back to this one are cycles, and convert to null
+    ConversionContext context;
+    context.begin(lua_topointer(L, p_index));
+    ConversionContext::DepthGuard depth_guard(context);
+
     int iter = 0;
     while ((iter = lua_rawiter(L, p_index, iter)) >= 0)
     {
-        Variant key = to_variant(L, -2);
-        Variant value = to_variant(L, -1);
+        Variant key = to_variant(L, -2, context);
+        Variant value = to_variant(L, -1, context);
         lua_pop(L, 2);
 
         dict[key] = value;
@@ -45,16 +53,74 @@ Dictionary gdluau::to_dictionary(lua_State *L, int p_index, bool *r_success)
     return dict;
 }
 
+Dictionary gdluau::to_dictionary_typed(lua_State *L, int p_index, Variant::Type p_key_type, Variant::Type p_value_type)
+{
+    Dictionary dict;
+    dict.set_typed(p_key_type, StringName(), Variant(), p_value_type, StringName(), Variant());
+
+    ERR_FAIL_COND_V_MSG(!is_valid_index(L, p_index), dict, vformat("to_dictionary_typed(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
+
+    if (!lua_istable(L, p_index)) [[unlikely]]
+    {
+        // Not a table
+        return dict;
+    }
+
+    ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 2), dict, vformat("to_dictionary_typed(%d): Stack overflow. Cannot grow stack.", p_index));
+
+    TypedElementReader key_reader = get_typed_element_reader(p_key_type);
+    TypedElementReader value_reader = get_typed_element_reader(p_value_type);
+
+    Variant key;
+    int iter = 0;
+    while ((iter = lua_rawiter(L, p_index, iter)) >= 0)
+    {
+        if (!key_reader(L, -2, key)) [[unlikely]]
+        {
+            lua_pop(L, 2);
+            dict.clear();
+            ERR_FAIL_V_MSG(dict, vformat("to_dictionary_typed(%d): Key can't be converted to %s.", p_index, Variant::get_type_name(p_key_type)));
+        }
+
+        // The value is written in place, as the reader has already converted it to the value type
+        Variant &value = dict[key];
+        if (!value_reader(L, -1, value)) [[unlikely]]
+        {
+            lua_pop(L, 2);
+            dict.clear();
+            ERR_FAIL_V_MSG(dict, vformat("to_dictionary_typed(%d): Value for key %s can't be converted to %s.", p_index, key.stringify(), Variant::get_type_name(p_value_type)));
+        }
+
+        lua_pop(L, 2);
+    }
+
+    return dict;
+}
+
 void gdluau::push_dictionary(lua_State *L, const Dictionary &p_dict)
 {
     ERR_FAIL_COND_MSG(!lua_checkstack(L, 3), "push_dictionary(): Stack overflow. Cannot grow stack.");
 
-    lua_createtable(L, 0, p_dict.size());
-    for (const Variant &key : p_dict.keys())
+    lua_createtable(L, 0, static_cast<int>(p_dict.size()));
+
+    TypedElementPusher key_pusher = get_typed_element_pusher(static_cast<Variant::Type>(p_dict.get_typed_key_builtin()));
+    TypedElementPusher value_pusher = get_typed_element_pusher(static_cast<Variant::Type>(p_dict.get_typed_value_builtin()));
+
+    // Iterating the Dictionary as a Variant walks its keys in place, rather than copying them into an Array.
+    // For Dictionaries, the iterator is the current key.
+    Variant dict_var = p_dict;
+    Variant key;
+    bool valid;
+    if (!dict_var.iter_init(key, valid))
     {
-        Variant value = p_dict[key];
-        push_variant(L, key);
-        push_variant(L, value);
-        lua_rawset(L, -3);
+        // Empty
+        return;
     }
+
+    do
+    {
+        key_pusher(L, key);
+        value_pusher(L, p_dict[key]); // Const operator[] returns a reference, without copying the value
+        lua_rawset(L, -3);
+    } while (dict_var.iter_next(key, valid));
 }
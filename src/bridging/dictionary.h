@@ -1,6 +1,7 @@
 #pragma once
 
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/variant.hpp>
 
 struct lua_State;
 
@@ -9,5 +10,11 @@ namespace gdluau
     using namespace godot;
 
     Dictionary to_dictionary(lua_State *p_L, int p_index, bool *r_success = nullptr);
+
+    // Converts the table at p_index to a Dictionary typed as [p_key_type, p_value_type], converting each key and
+    // value straight to those types. Fails, returning an empty Dictionary, if any entry can't be converted.
+    Dictionary to_dictionary_typed(lua_State *p_L, int p_index, Variant::Type p_key_type, Variant::Type p_value_type);
+
+    // Typed Dictionaries push their keys and values without checking each one's type
     void push_dictionary(lua_State *p_L, const Dictionary &p_dict);
 } // namespace gdluau
@@ -1,12 +1,17 @@
 #include "bridging/object.h"
 
+#include "bridging/callable.h"
 #include "bridging/variant.h"
 #include "helpers.h"
 #include "lua_state.h"
 #include "static_strings.h"
+#include "string_cache.h"
 
+#include <godot_cpp/classes/class_db_singleton.hpp>
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/godot.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/variant/variant.hpp>
 #include <lua.h>
 #include <lualib.h>
@@ -106,6 +111,328 @@ static int object_le(lua_State *L)
     return 1;
 }
 
+// Member lookups for the built-in method and property dispatchers, resolved once per (class, atom) through ClassDB
+enum class MemberKind : uint8_t
+{
+    UNRESOLVED,
+    METHOD,
+    PROPERTY, // Property with accessors that can be called directly
+    UNKNOWN,  // Not known to ClassDB, but could still be provided by a script or _get/_set
+};
+
+struct MemberCacheEntry
+{
+    MemberKind kind = MemberKind::UNRESOLVED;
+    StringName name;
+
+    // Only set for PROPERTY. Either may be empty (e.g., read-only properties).
+    StringName getter;
+    StringName setter;
+};
+
+struct ClassMemberCache
+{
+    // Sparse, since a class only sees a few of the atoms in use. HashMap elements are allocated
+    // individually, so references to entries stay valid if a call re-enters Lua and adds more.
+    HashMap<int, MemberCacheEntry> by_atom;
+};
+
+// Lives in the upvalues of the Object metamethods, so there is one per VM. Lua VMs are
+// single-threaded, so this doesn't need any synchronization.
+struct ObjectMemberCache
+{
+    HashMap<StringName, ClassMemberCache> classes;
+
+    // Consecutive lookups usually hit the same class
+    StringName last_class_name;
+    ClassMemberCache *last_class = nullptr;
+};
+
+static void object_member_cache_dtor(void *ud)
+{
+    ObjectMemberCache *cache = static_cast<ObjectMemberCache *>(ud);
+    cache->~ObjectMemberCache();
+}
+
+static StringName get_object_class_name(Object *p_obj)
+{
+    // Avoids the String allocation of Object::get_class()
+    StringName class_name;
+    internal::gdextension_interface_object_get_class_name(p_obj->_owner, internal::library, class_name._native_ptr());
+    return class_name;
+}
+
+static void resolve_member(const StringName &p_class_name, const StringName &p_name, MemberCacheEntry &r_entry)
+{
+    ClassDBSingleton *class_db = ClassDBSingleton::get_singleton();
+    r_entry.name = p_name;
+
+    if (class_db->class_has_method(p_class_name, p_name))
+    {
+        r_entry.kind = MemberKind::METHOD;
+        return;
+    }
+
+    r_entry.getter = class_db->class_get_property_getter(p_class_name, p_name);
+    r_entry.setter = class_db->class_get_property_setter(p_class_name, p_name);
+    r_entry.kind = r_entry.getter.is_empty() && r_entry.setter.is_empty() ? MemberKind::UNKNOWN : MemberKind::PROPERTY;
+}
+
+static MemberCacheEntry &lookup_member(ObjectMemberCache *p_cache, Object *p_obj, const char *p_name, int p_atom, MemberCacheEntry &r_uncached)
+{
+    StringName class_name = get_object_class_name(p_obj);
+
+    if (p_atom < 0) [[unlikely]]
+    {
+        // String was not atomized, so there's nothing to key the cache on
+        resolve_member(class_name, StringName(String::utf8(p_name)), r_uncached);
+        return r_uncached;
+    }
+
+    if (!p_cache->last_class || p_cache->last_class_name != class_name)
+    {
+        p_cache->last_class = &p_cache->classes[class_name];
+        p_cache->last_class_name = class_name;
+    }
+
+    HashMap<int, MemberCacheEntry> &by_atom = p_cache->last_class->by_atom;
+    MemberCacheEntry *entry = by_atom.getptr(p_atom);
+    if (!entry) [[unlikely]]
+    {
+        MemberCacheEntry resolved;
+        resolve_member(class_name, string_name_for_atom(p_atom), resolved);
+        entry = &by_atom.insert(p_atom, resolved)->value;
+    }
+
+    return *entry;
+}
+
+// Calls a method on p_obj, with arguments taken from stack index 2 onwards.
+// Returns the number of results, or raises a Lua error.
+static int call_object_method(lua_State *L, ObjectMemberCache *p_cache, Object *p_obj, const char *p_name, int p_atom)
+{
+    int arg_count = lua_gettop(L) - 1;
+    bool success = true;
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        MemberCacheEntry uncached;
+        const MemberCacheEntry &entry = lookup_member(p_cache, p_obj, p_name, p_atom, uncached);
+
+        if (entry.kind != MemberKind::METHOD && !p_obj->has_method(entry.name)) [[unlikely]]
+        {
+            CharString error_msg = vformat("%s has no method '%s'", p_obj->get_class(), entry.name).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+            success = false;
+        }
+        else
+        {
+            Variant self(p_obj);
+            StackVariantArgs args(L, 2, arg_count);
+
+            Variant result;
+            GDExtensionCallError error;
+            self.callp(entry.name, args.ptrs(), args.size(), result, error);
+
+            if (error.error != GDEXTENSION_CALL_OK) [[unlikely]]
+            {
+                CharString error_msg = describe_call_error(vformat("%s.%s", p_obj->get_class(), entry.name), error).utf8();
+                lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+                success = false;
+            }
+            else
+            {
+                push_variant(L, result);
+            }
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
+
+    return 1;
+}
+
+// Object.__namecall metamethod, for obj:method(...) syntax
+static int object_namecall(lua_State *L)
+{
+    int atom = -1;
+    const char *name = lua_namecallatom(L, &atom);
+    if (!name) [[unlikely]]
+    {
+        luaL_error(L, "Object.__namecall: method name not available");
+    }
+
+    Object *obj = get_userdata_instance(lua_touserdata(L, 1));
+    if (!obj) [[unlikely]]
+    {
+        luaL_error(L, "Attempt to call method '%s' on a freed Object", name);
+    }
+
+    ObjectMemberCache *cache = static_cast<ObjectMemberCache *>(lua_touserdata(L, lua_upvalueindex(1)));
+    return call_object_method(L, cache, obj, name, atom);
+}
+
+// Function returned by Object.__index for methods, for obj.method(obj, ...) syntax
+static int object_method_closure(lua_State *L)
+{
+    Object *obj = to_full_object(L, 1);
+    if (!obj) [[unlikely]]
+    {
+        luaL_typeerror(L, 1, "Object");
+    }
+
+    int atom = -1;
+    const char *name = lua_tolstringatom(L, lua_upvalueindex(2), nullptr, &atom);
+
+    ObjectMemberCache *cache = static_cast<ObjectMemberCache *>(lua_touserdata(L, lua_upvalueindex(1)));
+    return call_object_method(L, cache, obj, name, atom);
+}
+
+// Object.__index metamethod
+static int object_index(lua_State *L)
+{
+    Object *obj = get_userdata_instance(lua_touserdata(L, 1));
+    if (!obj) [[unlikely]]
+    {
+        luaL_error(L, "Attempt to index a freed Object");
+    }
+
+    int atom = -1;
+    const char *key = lua_tolstringatom(L, 2, nullptr, &atom);
+    if (!key) [[unlikely]]
+    {
+        luaL_typeerror(L, 2, "string");
+    }
+
+    ObjectMemberCache *cache = static_cast<ObjectMemberCache *>(lua_touserdata(L, lua_upvalueindex(1)));
+    bool success = true;
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        MemberCacheEntry uncached;
+        MemberCacheEntry &entry = lookup_member(cache, obj, key, atom, uncached);
+
+        if (entry.kind == MemberKind::PROPERTY && !entry.getter.is_empty()) [[likely]]
+        {
+            Variant self(obj);
+            Variant result;
+            GDExtensionCallError error;
+            self.callp(entry.getter, nullptr, 0, result, error);
+
+            if (error.error == GDEXTENSION_CALL_ERROR_TOO_FEW_ARGUMENTS) [[unlikely]]
+            {
+                // Indexed properties share a getter that takes an extra argument, which ClassDB doesn't
+                // expose. Stop using the accessor for this property.
+                entry.kind = MemberKind::UNKNOWN;
+                push_variant(L, obj->get(entry.name));
+            }
+            else if (error.error != GDEXTENSION_CALL_OK) [[unlikely]]
+            {
+                CharString error_msg = describe_call_error(vformat("%s.%s", obj->get_class(), entry.getter), error).utf8();
+                lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+                success = false;
+            }
+            else
+            {
+                push_variant(L, result);
+            }
+        }
+        else if (entry.kind == MemberKind::METHOD || (entry.kind == MemberKind::UNKNOWN && obj->has_method(entry.name)))
+        {
+            // upvalues: [cache, method name]
+            lua_pushvalue(L, lua_upvalueindex(1));
+            lua_pushvalue(L, 2);
+            lua_pushcclosure(L, object_method_closure, "Object.method", 2);
+        }
+        else
+        {
+            push_variant(L, obj->get(entry.name));
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
+
+    return 1;
+}
+
+// Object.__newindex metamethod
+static int object_newindex(lua_State *L)
+{
+    Object *obj = get_userdata_instance(lua_touserdata(L, 1));
+    if (!obj) [[unlikely]]
+    {
+        luaL_error(L, "Attempt to index a freed Object");
+    }
+
+    int atom = -1;
+    const char *key = lua_tolstringatom(L, 2, nullptr, &atom);
+    if (!key) [[unlikely]]
+    {
+        luaL_typeerror(L, 2, "string");
+    }
+
+    ObjectMemberCache *cache = static_cast<ObjectMemberCache *>(lua_touserdata(L, lua_upvalueindex(1)));
+    bool success = true;
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        Variant value = to_variant(L, 3);
+        MemberCacheEntry uncached;
+        MemberCacheEntry &entry = lookup_member(cache, obj, key, atom, uncached);
+
+        if (entry.kind == MemberKind::PROPERTY && !entry.setter.is_empty()) [[likely]]
+        {
+            Variant self(obj);
+            const Variant *args[1] = { &value };
+            Variant result;
+            GDExtensionCallError error;
+            self.callp(entry.setter, args, 1, result, error);
+
+            if (error.error == GDEXTENSION_CALL_ERROR_TOO_FEW_ARGUMENTS) [[unlikely]]
+            {
+                // Indexed property (see object_index)
+                entry.kind = MemberKind::UNKNOWN;
+                obj->set(entry.name, value);
+            }
+            else if (error.error != GDEXTENSION_CALL_OK) [[unlikely]]
+            {
+                CharString error_msg = describe_call_error(vformat("%s.%s", obj->get_class(), entry.setter), error).utf8();
+                lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+                success = false;
+            }
+        }
+        else if (entry.kind == MemberKind::PROPERTY) [[unlikely]]
+        {
+            CharString error_msg = vformat("Property '%s' of %s is read-only", entry.name, obj->get_class()).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+            success = false;
+        }
+        else if (entry.kind == MemberKind::METHOD) [[unlikely]]
+        {
+            CharString error_msg = vformat("Cannot assign to method '%s' of %s", entry.name, obj->get_class()).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+            success = false;
+        }
+        else
+        {
+            obj->set(entry.name, value);
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
+
+    return 0;
+}
+
 static bool has_object_metatable(lua_State *L, int p_index)
 {
     ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 3), false, vformat("has_object_metatable(%d): Stack overflow. Cannot grow stack.", p_index));
@@ -146,6 +473,23 @@ void gdluau::push_object_metatable(lua_State *L)
         return;
     }
 
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "push_object_metatable(): Stack overflow. Cannot grow stack.");
+
+    // Shared by the method and property dispatchers
+    void *cache = lua_newuserdatadtor(L, sizeof(ObjectMemberCache), object_member_cache_dtor);
+    memnew_placement(cache, ObjectMemberCache);
+
+    lua_pushvalue(L, -1);
+    lua_pushcclosure(L, object_namecall, "Object.__namecall", 1);
+    lua_setfield(L, -3, "__namecall");
+
+    lua_pushvalue(L, -1);
+    lua_pushcclosure(L, object_index, "Object.__index", 1);
+    lua_setfield(L, -3, "__index");
+
+    lua_pushcclosure(L, object_newindex, "Object.__newindex", 1);
+    lua_setfield(L, -2, "__newindex");
+
     lua_pushcfunction(L, object_tostring, "Object.__tostring");
     lua_setfield(L, -2, "__tostring");
 
@@ -0,0 +1,653 @@
+#include "bridging/packed_array.h"
+
+#include "bridging/variant.h"
+#include "helpers.h"
+#include "string_cache.h"
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/core/type_info.hpp>
+#include <lua.h>
+#include <lualib.h>
+
+#include <cstring>
+#include <type_traits>
+
+using namespace gdluau;
+using namespace godot;
+
+template <typename TPacked>
+using PackedElement = std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<const TPacked &>().ptr())>>;
+
+template <typename TPacked>
+constexpr Variant::Type PACKED_VARIANT_TYPE = static_cast<Variant::Type>(GetTypeInfo<TPacked>::VARIANT_TYPE);
+
+// Whether elements can be copied to and from raw bytes
+template <typename TPacked>
+constexpr bool HAS_RAW_ELEMENTS = !std::is_same_v<PackedElement<TPacked>, String>;
+
+// Registry names of the native userdata metatables. PackedByteArray has none, as it is represented by a buffer.
+template <typename TPacked>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME = nullptr;
+
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedInt32Array> = "GDPackedInt32Array";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedInt64Array> = "GDPackedInt64Array";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedFloat32Array> = "GDPackedFloat32Array";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedFloat64Array> = "GDPackedFloat64Array";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedStringArray> = "GDPackedStringArray";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedVector2Array> = "GDPackedVector2Array";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedVector3Array> = "GDPackedVector3Array";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedColorArray> = "GDPackedColorArray";
+template <>
+constexpr const char *PACKED_ARRAY_METATABLE_NAME<PackedVector4Array> = "GDPackedVector4Array";
+
+template <typename T>
+static void read_element(lua_State *L, int p_index, T &r_value)
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (lua_type(L, p_index) == LUA_TNUMBER) [[likely]]
+        {
+            double num = lua_tonumber(L, p_index);
+            if constexpr (std::is_integral_v<T>)
+            {
+                r_value = static_cast<T>(static_cast<int64_t>(num));
+            }
+            else
+            {
+                r_value = static_cast<T>(num);
+            }
+
+            return;
+        }
+    }
+    else if constexpr (std::is_same_v<T, Vector3>)
+    {
+        if (const float *vec = lua_tovector(L, p_index)) [[likely]]
+        {
+            r_value = Vector3(vec[0], vec[1], vec[2]);
+            return;
+        }
+    }
+    else if constexpr (std::is_same_v<T, String>)
+    {
+        if (lua_type(L, p_index) == LUA_TSTRING) [[likely]]
+        {
+            size_t len;
+            const char *str = lua_tolstring(L, p_index, &len);
+            r_value = String::utf8(str, len);
+            return;
+        }
+    }
+
+    // Remaining element types (Vector2, Color, ...) are Variant userdata, and other values convert like Godot would
+    r_value = to_variant(L, p_index);
+}
+
+template <typename T>
+static void push_element(lua_State *L, const T &p_value)
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        lua_pushnumber(L, static_cast<double>(p_value));
+    }
+    else if constexpr (std::is_same_v<T, Vector3>)
+    {
+        lua_pushvector(L, p_value.x, p_value.y, p_value.z);
+    }
+    else if constexpr (std::is_same_v<T, String>)
+    {
+        CharString utf8 = p_value.utf8();
+        lua_pushlstring(L, utf8.get_data(), utf8.length());
+    }
+    else
+    {
+        push_variant(L, p_value);
+    }
+}
+
+template <typename TPacked>
+static bool copy_raw_elements(const void *p_data, size_t p_size, TPacked &r_array)
+{
+    using Element = PackedElement<TPacked>;
+
+    ERR_FAIL_COND_V_MSG(p_size % sizeof(Element) != 0, false, vformat("to_packed_array(): Data size %d is not a multiple of the element size %d.", static_cast<int64_t>(p_size), static_cast<int64_t>(sizeof(Element))));
+
+    r_array.resize(p_size / sizeof(Element));
+    if (p_size > 0)
+    {
+        memcpy(static_cast<void *>(r_array.ptrw()), p_data, p_size);
+    }
+
+    return true;
+}
+
+template <typename TPacked>
+bool gdluau::to_packed_array(lua_State *L, int p_index, TPacked &r_array)
+{
+    using Element = PackedElement<TPacked>;
+
+    ERR_FAIL_COND_V_MSG(!is_valid_index(L, p_index), false, vformat("to_packed_array(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
+
+    switch (lua_type(L, p_index))
+    {
+    case LUA_TTABLE:
+    {
+        ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 1), false, vformat("to_packed_array(%d): Stack overflow. Cannot grow stack.", p_index));
+
+        int table_index = lua_absindex(L, p_index);
+        int len = lua_objlen(L, table_index);
+
+        r_array.resize(len);
+        Element *dst = r_array.ptrw();
+        for (int i = 0; i < len; i++)
+        {
+            lua_rawgeti(L, table_index, i + 1);
+            read_element(L, -1, dst[i]);
+            lua_pop(L, 1);
+        }
+
+        return true;
+    }
+
+    case LUA_TBUFFER:
+    {
+        if constexpr (HAS_RAW_ELEMENTS<TPacked>)
+        {
+            size_t size;
+            const void *data = lua_tobuffer(L, p_index, &size);
+            return copy_raw_elements(data, size, r_array);
+        }
+        else
+        {
+            ERR_PRINT(vformat("to_packed_array(%d): Cannot convert buffer to %s.", p_index, Variant::get_type_name(PACKED_VARIANT_TYPE<TPacked>)));
+            return false;
+        }
+    }
+
+    case LUA_TUSERDATA:
+    {
+        if (get_native_userdata_type(L, p_index) == PACKED_VARIANT_TYPE<TPacked>) [[likely]]
+        {
+            // Shares data with the original array
+            r_array = *static_cast<TPacked *>(lua_touserdata(L, p_index));
+            return true;
+        }
+
+        Variant var = to_variant(L, p_index);
+        if (var.get_type() == PACKED_VARIANT_TYPE<TPacked>)
+        {
+            // Shares data with the original array
+            r_array = var;
+            return true;
+        }
+
+        if constexpr (HAS_RAW_ELEMENTS<TPacked>)
+        {
+            if (var.get_type() == Variant::PACKED_BYTE_ARRAY)
+            {
+                PackedByteArray bytes = var;
+                return copy_raw_elements(bytes.ptr(), bytes.size(), r_array);
+            }
+        }
+
+        return false;
+    }
+
+    default:
+        return false;
+    }
+}
+
+template <typename TPacked>
+void gdluau::push_packed_array_table(lua_State *L, const TPacked &p_array)
+{
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 3), "push_packed_array_table(): Stack overflow. Cannot grow stack."); // Table + element + possible metatable
+
+    int64_t size = p_array.size();
+    const auto *src = p_array.ptr();
+
+    lua_createtable(L, static_cast<int>(size), 0);
+    for (int64_t i = 0; i < size; i++)
+    {
+        push_element(L, src[i]);
+        lua_rawseti(L, -2, static_cast<int>(i + 1)); // Lua arrays are 1-based
+    }
+}
+
+template <typename TPacked>
+void gdluau::push_packed_array_buffer(lua_State *L, const TPacked &p_array)
+{
+    static_assert(HAS_RAW_ELEMENTS<TPacked>, "Packed array elements cannot be copied as raw data");
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 1), "push_packed_array_buffer(): Stack overflow. Cannot grow stack.");
+
+    size_t size = p_array.size() * sizeof(PackedElement<TPacked>);
+    void *buf = lua_newbuffer(L, size);
+    if (size > 0)
+    {
+        memcpy(buf, static_cast<const void *>(p_array.ptr()), size);
+    }
+}
+
+template <typename TPacked>
+static void packed_array_dtor(void *ud)
+{
+    TPacked *array = static_cast<TPacked *>(ud);
+    array->~TPacked();
+}
+
+template <typename TPacked>
+static TPacked *check_packed_array(lua_State *L, int p_index)
+{
+    return static_cast<TPacked *>(luaL_checkudata(L, p_index, PACKED_ARRAY_METATABLE_NAME<TPacked>));
+}
+
+// Returns the 0-based element index at p_key_index, raising an error if it is out of range.
+// Negative indices count back from the end, like in GDScript.
+static int64_t check_element_index(lua_State *L, int p_key_index, int64_t p_size)
+{
+    double num = luaL_checknumber(L, p_key_index);
+    int64_t index = static_cast<int64_t>(num);
+    if (index < 0)
+    {
+        index += p_size;
+    }
+
+    if (index < 0 || index >= p_size || static_cast<double>(static_cast<int64_t>(num)) != num) [[unlikely]]
+    {
+        luaL_error(L, "index %s out of range for array of size %d", lua_tostring(L, p_key_index), static_cast<int>(p_size));
+    }
+
+    return index;
+}
+
+// PackedArray.__index metamethod, reading the element in place
+template <typename TPacked>
+static int packed_array_index(lua_State *L)
+{
+    const TPacked *array = check_packed_array<TPacked>(L, 1);
+    int64_t index = check_element_index(L, 2, array->size());
+
+    push_element(L, array->ptr()[index]);
+    return 1;
+}
+
+// PackedArray.__newindex metamethod, writing the element in place
+template <typename TPacked>
+static int packed_array_newindex(lua_State *L)
+{
+    TPacked *array = check_packed_array<TPacked>(L, 1);
+    int64_t index = check_element_index(L, 2, array->size());
+
+    // ptrw() detaches the array from any others it still shares data with
+    read_element(L, 3, array->ptrw()[index]);
+    return 0;
+}
+
+// PackedArray.__len metamethod
+template <typename TPacked>
+static int packed_array_len(lua_State *L)
+{
+    const TPacked *array = check_packed_array<TPacked>(L, 1);
+    lua_pushnumber(L, static_cast<double>(array->size()));
+    return 1;
+}
+
+// Iterator function returned from PackedArray.__iter, yielding (index, element) pairs.
+// The control variable is the previous index, starting at -1.
+template <typename TPacked>
+static int packed_array_next(lua_State *L)
+{
+    const TPacked *array = check_packed_array<TPacked>(L, 1);
+    int64_t index = static_cast<int64_t>(luaL_checknumber(L, 2)) + 1;
+    if (index >= array->size())
+    {
+        return 0;
+    }
+
+    lua_pushnumber(L, static_cast<double>(index));
+    push_element(L, array->ptr()[index]);
+    return 2;
+}
+
+// PackedArray.__iter metamethod, which doesn't allocate an iterator closure
+template <typename TPacked>
+static int packed_array_iter(lua_State *L)
+{
+    check_packed_array<TPacked>(L, 1);
+    lua_settop(L, 1);
+
+    lua_pushcfunction(L, packed_array_next<TPacked>, "PackedArray.__iter.next");
+    lua_insert(L, 1);
+    lua_pushnumber(L, -1);
+    return 3;
+}
+
+// PackedArray.__namecall metamethod, for arr:method(...) syntax
+template <typename TPacked>
+static int packed_array_namecall(lua_State *L)
+{
+    int atom = -1;
+    const char *name = lua_namecallatom(L, &atom);
+    if (!name) [[unlikely]]
+    {
+        luaL_error(L, "PackedArray.__namecall: method name not available");
+    }
+
+    TPacked *array = check_packed_array<TPacked>(L, 1);
+    int arg_count = lua_gettop(L) - 1;
+    bool success = true;
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        StringName method = string_name_for_atom(atom);
+        if (method.is_empty())
+        {
+            method = StringName(String::utf8(name));
+        }
+
+        StackVariantArgs args(L, 2, arg_count);
+
+        // Move the data into the Variant for the call, so that mutating methods
+        // like append() don't have to copy the array on write
+        Variant self = *array;
+        *array = TPacked();
+
+        Variant result;
+        GDExtensionCallError error;
+        self.callp(method, args.ptrs(), args.size(), result, error);
+
+        *array = self;
+
+        if (error.error != GDEXTENSION_CALL_OK) [[unlikely]]
+        {
+            CharString error_msg = describe_call_error(vformat("%s.%s", Variant::get_type_name(PACKED_VARIANT_TYPE<TPacked>), method), error).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+            success = false;
+        }
+        else
+        {
+            push_variant(L, result);
+        }
+    }
+
+    if (!success) [[unlikely]]
+    {
+        lua_error(L);
+    }
+
+    return 1;
+}
+
+// PackedArray.__tostring metamethod
+template <typename TPacked>
+static int packed_array_tostring(lua_State *L)
+{
+    const TPacked *array = check_packed_array<TPacked>(L, 1);
+    CharString utf8 = Variant(*array).stringify().utf8();
+
+    lua_pushlstring(L, utf8.get_data(), utf8.length());
+    return 1;
+}
+
+// Binary operators for packed arrays (comparison and concatenation)
+template <Variant::Operator op>
+static int packed_array_op(lua_State *L)
+{
+    bool is_valid = false;
+    {
+        Variant a = to_variant(L, 1);
+        Variant b = to_variant(L, 2);
+
+        Variant result;
+        Variant::evaluate(op, a, b, result, is_valid);
+
+        if (is_valid) [[likely]]
+        {
+            push_variant(L, result);
+        }
+    }
+
+    if (!is_valid) [[unlikely]]
+    {
+        luaL_error(L, "Cannot use operator %d on %s and %s", static_cast<int>(op), luaL_typename(L, 1), luaL_typename(L, 2));
+    }
+
+    return 1;
+}
+
+template <typename TPacked>
+static void push_packed_array_metatable(lua_State *L)
+{
+    if (!luaL_newmetatable(L, PACKED_ARRAY_METATABLE_NAME<TPacked>)) [[likely]]
+    {
+        // Metatable already configured
+        return;
+    }
+
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "push_packed_array_metatable(): Stack overflow. Cannot grow stack.");
+
+    lua_pushcfunction(L, packed_array_index<TPacked>, "PackedArray.__index");
+    lua_setfield(L, -2, "__index");
+
+    lua_pushcfunction(L, packed_array_newindex<TPacked>, "PackedArray.__newindex");
+    lua_setfield(L, -2, "__newindex");
+
+    lua_pushcfunction(L, packed_array_len<TPacked>, "PackedArray.__len");
+    lua_setfield(L, -2, "__len");
+
+    lua_pushcfunction(L, packed_array_iter<TPacked>, "PackedArray.__iter");
+    lua_setfield(L, -2, "__iter");
+
+    lua_pushcfunction(L, packed_array_namecall<TPacked>, "PackedArray.__namecall");
+    lua_setfield(L, -2, "__namecall");
+
+    lua_pushcfunction(L, packed_array_tostring<TPacked>, "PackedArray.__tostring");
+    lua_setfield(L, -2, "__tostring");
+
+    lua_pushcfunction(L, packed_array_op<Variant::OP_ADD>, "PackedArray.__add");
+    lua_setfield(L, -2, "__add");
+
+    lua_pushcfunction(L, packed_array_op<Variant::OP_EQUAL>, "PackedArray.__eq");
+    lua_setfield(L, -2, "__eq");
+
+    lua_pushcfunction(L, generic_lua_concat, "PackedArray.__concat");
+    lua_setfield(L, -2, "__concat");
+
+    register_native_userdata_metatable(L, PACKED_VARIANT_TYPE<TPacked>);
+
+    // Freeze metatable
+    lua_setreadonly(L, -1, 1);
+}
+
+template <typename TPacked>
+void gdluau::push_packed_array(lua_State *L, const TPacked &p_array)
+{
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 4), "push_packed_array(): Stack overflow. Cannot grow stack."); // Array + metatable + registry entry
+
+    // Copying the array only takes a reference to its data
+    void *ud = lua_newuserdatadtor(L, sizeof(TPacked), packed_array_dtor<TPacked>);
+    memnew_placement(ud, TPacked(p_array));
+
+    push_packed_array_metatable<TPacked>(L);
+    lua_setmetatable(L, -2);
+}
+
+#define INSTANTIATE_PACKED_ARRAY(m_type)                                                        \
+    template bool gdluau::to_packed_array<m_type>(lua_State *, int, m_type &);                  \
+    template void gdluau::push_packed_array_table<m_type>(lua_State *, const m_type &);
+
+#define INSTANTIATE_RAW_PACKED_ARRAY(m_type) \
+    INSTANTIATE_PACKED_ARRAY(m_type)         \
+    template void gdluau::push_packed_array_buffer<m_type>(lua_State *, const m_type &);
+
+#define INSTANTIATE_NATIVE_PACKED_ARRAY(m_type) \
+    template void gdluau::push_packed_array<m_type>(lua_State *, const m_type &);
+
+INSTANTIATE_RAW_PACKED_ARRAY(PackedByteArray)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedInt32Array)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedInt64Array)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedFloat32Array)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedFloat64Array)
+INSTANTIATE_PACKED_ARRAY(PackedStringArray)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedVector2Array)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedVector3Array)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedColorArray)
+INSTANTIATE_RAW_PACKED_ARRAY(PackedVector4Array)
+
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedInt32Array)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedInt64Array)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedFloat32Array)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedFloat64Array)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedStringArray)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedVector2Array)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedVector3Array)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedColorArray)
+INSTANTIATE_NATIVE_PACKED_ARRAY(PackedVector4Array)
+
+bool gdluau::push_packed_variant(lua_State *L, const Variant &p_variant)
+{
+    switch (p_variant.get_type())
+    {
+    case Variant::PACKED_INT32_ARRAY:
+        push_packed_array<PackedInt32Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_INT64_ARRAY:
+        push_packed_array<PackedInt64Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_FLOAT32_ARRAY:
+        push_packed_array<PackedFloat32Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_FLOAT64_ARRAY:
+        push_packed_array<PackedFloat64Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_STRING_ARRAY:
+        push_packed_array<PackedStringArray>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR2_ARRAY:
+        push_packed_array<PackedVector2Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR3_ARRAY:
+        push_packed_array<PackedVector3Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_COLOR_ARRAY:
+        push_packed_array<PackedColorArray>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR4_ARRAY:
+        push_packed_array<PackedVector4Array>(L, p_variant);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool gdluau::push_packed_variant_table(lua_State *L, const Variant &p_variant)
+{
+    switch (p_variant.get_type())
+    {
+    case Variant::PACKED_BYTE_ARRAY:
+        push_packed_array_table<PackedByteArray>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_INT32_ARRAY:
+        push_packed_array_table<PackedInt32Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_INT64_ARRAY:
+        push_packed_array_table<PackedInt64Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_FLOAT32_ARRAY:
+        push_packed_array_table<PackedFloat32Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_FLOAT64_ARRAY:
+        push_packed_array_table<PackedFloat64Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_STRING_ARRAY:
+        push_packed_array_table<PackedStringArray>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR2_ARRAY:
+        push_packed_array_table<PackedVector2Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR3_ARRAY:
+        push_packed_array_table<PackedVector3Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_COLOR_ARRAY:
+        push_packed_array_table<PackedColorArray>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR4_ARRAY:
+        push_packed_array_table<PackedVector4Array>(L, p_variant);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool gdluau::push_packed_variant_buffer(lua_State *L, const Variant &p_variant)
+{
+    switch (p_variant.get_type())
+    {
+    case Variant::PACKED_BYTE_ARRAY:
+        push_packed_array_buffer<PackedByteArray>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_INT32_ARRAY:
+        push_packed_array_buffer<PackedInt32Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_INT64_ARRAY:
+        push_packed_array_buffer<PackedInt64Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_FLOAT32_ARRAY:
+        push_packed_array_buffer<PackedFloat32Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_FLOAT64_ARRAY:
+        push_packed_array_buffer<PackedFloat64Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR2_ARRAY:
+        push_packed_array_buffer<PackedVector2Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR3_ARRAY:
+        push_packed_array_buffer<PackedVector3Array>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_COLOR_ARRAY:
+        push_packed_array_buffer<PackedColorArray>(L, p_variant);
+        return true;
+
+    case Variant::PACKED_VECTOR4_ARRAY:
+        push_packed_array_buffer<PackedVector4Array>(L, p_variant);
+        return true;
+
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <godot_cpp/variant/variant.hpp>
+
+struct lua_State;
+
+namespace gdluau
+{
+    using namespace godot;
+
+    // Converts the value at p_index into a Packed*Array, writing each element directly
+    // into the result instead of going through an Array of Variants:
+    // - Tables are read as sequences of elements (numbers, vectors, strings, ...)
+    // - Buffers are read as raw element data, which must be a multiple of the element size
+    // - Packed arrays of the same type are shared, and PackedByteArrays are read as raw element data
+    // Returns false if the value can't be converted.
+    //
+    // Instantiated for all Packed*Array types. Raw data conversions are not supported for PackedStringArray.
+    template <typename TPacked>
+    bool to_packed_array(lua_State *p_L, int p_index, TPacked &r_array);
+
+    // Pushes the elements of a packed array as a Lua table
+    template <typename TPacked>
+    void push_packed_array_table(lua_State *p_L, const TPacked &p_array);
+
+    // Pushes the raw element data of a packed array as a Luau buffer
+    template <typename TPacked>
+    void push_packed_array_buffer(lua_State *p_L, const TPacked &p_array);
+
+    // Pushes the array as native userdata, sharing its data until either side writes to it.
+    // From Lua, elements are read and written in place with 0-based indices (negative indices
+    // count from the end), #arr is the size, `for i, v in arr` iterates without copying, and
+    // Godot methods are available with arr:method(...).
+    //
+    // Instantiated for all Packed*Array types except PackedByteArray, which is pushed as a buffer.
+    template <typename TPacked>
+    void push_packed_array(lua_State *p_L, const TPacked &p_array);
+
+    // Pushes a packed array Variant as native userdata. Returns false (pushing nothing) if p_variant
+    // is not a packed array with a native userdata representation. The userdata is registered with
+    // register_native_userdata_metatable(), which is how to_variant() reads it back.
+    bool push_packed_variant(lua_State *p_L, const Variant &p_variant);
+
+    // push_packed_array_table/buffer, dispatching on the Variant type. Return false (pushing nothing) if p_variant
+    // is not a packed array, or for push_packed_variant_buffer, is a PackedStringArray.
+    bool push_packed_variant_table(lua_State *p_L, const Variant &p_variant);
+    bool push_packed_variant_buffer(lua_State *p_L, const Variant &p_variant);
+} // namespace gdluau
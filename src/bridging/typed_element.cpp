@@ -0,0 +1,244 @@
+#include "bridging/typed_element.h"
+
+#include "bridging/variant.h"
+#include "helpers.h"
+#include "string_cache.h"
+
+#include <godot_cpp/variant/utility_functions.hpp>
+#include <lua.h>
+
+#include <cmath>
+
+using namespace gdluau;
+using namespace godot;
+
+static bool read_variant(lua_State *L, int p_index, Variant &r_value)
+{
+    r_value = to_variant(L, p_index);
+    return true;
+}
+
+static bool read_bool(lua_State *L, int p_index, Variant &r_value)
+{
+    if (!lua_isboolean(L, p_index)) [[unlikely]]
+    {
+        return false;
+    }
+
+    r_value = lua_toboolean(L, p_index) != 0;
+    return true;
+}
+
+static bool read_int(lua_State *L, int p_index, Variant &r_value)
+{
+    if (lua_type(L, p_index) != LUA_TNUMBER) [[unlikely]]
+    {
+        return false;
+    }
+
+    // Numbers with a fractional part aren't truncated, as to_variant() would keep them as floats
+    double num = lua_tonumber(L, p_index);
+    if (nearbyint(num) != num || !std::isfinite(num)) [[unlikely]]
+    {
+        return false;
+    }
+
+    r_value = static_cast<int64_t>(num);
+    return true;
+}
+
+static bool read_float(lua_State *L, int p_index, Variant &r_value)
+{
+    if (lua_type(L, p_index) != LUA_TNUMBER) [[unlikely]]
+    {
+        return false;
+    }
+
+    r_value = lua_tonumber(L, p_index);
+    return true;
+}
+
+static bool read_string(lua_State *L, int p_index, Variant &r_value)
+{
+    if (lua_type(L, p_index) != LUA_TSTRING) [[unlikely]]
+    {
+        return false;
+    }
+
+    size_t len;
+    const char *str = lua_tolstring(L, p_index, &len);
+    r_value = String::utf8(str, len);
+    return true;
+}
+
+static bool read_string_name(lua_State *L, int p_index, Variant &r_value)
+{
+    if (lua_type(L, p_index) != LUA_TSTRING) [[unlikely]]
+    {
+        return false;
+    }
+
+    // Goes through the atom cache, so repeated keys don't allocate new StringNames
+    r_value = to_string_name(L, p_index);
+    return true;
+}
+
+static bool read_vector3(lua_State *L, int p_index, Variant &r_value)
+{
+    const float *vec = lua_tovector(L, p_index);
+    if (!vec) [[unlikely]]
+    {
+        return false;
+    }
+
+    r_value = Vector3(vec[0], vec[1], vec[2]);
+    return true;
+}
+
+// Remaining types are converted generically, then checked against the element type
+template <Variant::Type TType>
+static bool read_converted(lua_State *L, int p_index, Variant &r_value)
+{
+    Variant value = to_variant(L, p_index);
+    if (value.get_type() == TType) [[likely]]
+    {
+        r_value = value;
+        return true;
+    }
+
+    if (!Variant::can_convert_strict(value.get_type(), TType))
+    {
+        return false;
+    }
+
+    r_value = UtilityFunctions::type_convert(value, TType);
+    return true;
+}
+
+static void push_bool(lua_State *L, const Variant &p_value)
+{
+    bool b = p_value;
+    lua_pushboolean(L, b ? 1 : 0);
+}
+
+static void push_number(lua_State *L, const Variant &p_value)
+{
+    double num = p_value;
+    lua_pushnumber(L, num);
+}
+
+static void push_string(lua_State *L, const Variant &p_value)
+{
+    String str = p_value;
+    CharString utf8 = str.utf8();
+    lua_pushlstring(L, utf8.get_data(), utf8.length());
+}
+
+static void push_string_name(lua_State *L, const Variant &p_value)
+{
+    CharString utf8 = char_string(p_value);
+    lua_pushlstring(L, utf8.get_data(), utf8.length());
+}
+
+static void push_vector3(lua_State *L, const Variant &p_value)
+{
+    Vector3 vec = p_value;
+    lua_pushvector(L, vec.x, vec.y, vec.z);
+}
+
+TypedElementReader gdluau::get_typed_element_reader(Variant::Type p_type)
+{
+    switch (p_type)
+    {
+    case Variant::NIL:
+        return read_variant;
+
+    case Variant::BOOL:
+        return read_bool;
+
+    case Variant::INT:
+        return read_int;
+
+    case Variant::FLOAT:
+        return read_float;
+
+    case Variant::STRING:
+        return read_string;
+
+    case Variant::STRING_NAME:
+        return read_string_name;
+
+    case Variant::VECTOR3:
+        return read_vector3;
+
+#define TYPED_ELEMENT_CONVERTED_READER(m_type) \
+    case Variant::m_type:                      \
+        return read_converted<Variant::m_type>;
+
+        TYPED_ELEMENT_CONVERTED_READER(VECTOR2)
+        TYPED_ELEMENT_CONVERTED_READER(VECTOR2I)
+        TYPED_ELEMENT_CONVERTED_READER(RECT2)
+        TYPED_ELEMENT_CONVERTED_READER(RECT2I)
+        TYPED_ELEMENT_CONVERTED_READER(VECTOR3I)
+        TYPED_ELEMENT_CONVERTED_READER(TRANSFORM2D)
+        TYPED_ELEMENT_CONVERTED_READER(VECTOR4)
+        TYPED_ELEMENT_CONVERTED_READER(VECTOR4I)
+        TYPED_ELEMENT_CONVERTED_READER(PLANE)
+        TYPED_ELEMENT_CONVERTED_READER(QUATERNION)
+        TYPED_ELEMENT_CONVERTED_READER(AABB)
+        TYPED_ELEMENT_CONVERTED_READER(BASIS)
+        TYPED_ELEMENT_CONVERTED_READER(TRANSFORM3D)
+        TYPED_ELEMENT_CONVERTED_READER(PROJECTION)
+        TYPED_ELEMENT_CONVERTED_READER(COLOR)
+        TYPED_ELEMENT_CONVERTED_READER(NODE_PATH)
+        TYPED_ELEMENT_CONVERTED_READER(RID)
+        TYPED_ELEMENT_CONVERTED_READER(OBJECT)
+        TYPED_ELEMENT_CONVERTED_READER(CALLABLE)
+        TYPED_ELEMENT_CONVERTED_READER(SIGNAL)
+        TYPED_ELEMENT_CONVERTED_READER(DICTIONARY)
+        TYPED_ELEMENT_CONVERTED_READER(ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_BYTE_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_INT32_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_INT64_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_FLOAT32_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_FLOAT64_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_STRING_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_VECTOR2_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_VECTOR3_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_COLOR_ARRAY)
+        TYPED_ELEMENT_CONVERTED_READER(PACKED_VECTOR4_ARRAY)
+
+#undef TYPED_ELEMENT_CONVERTED_READER
+
+    default:
+        return read_variant;
+    }
+}
+
+TypedElementPusher gdluau::get_typed_element_pusher(Variant::Type p_type)
+{
+    switch (p_type)
+    {
+    case Variant::BOOL:
+        return push_bool;
+
+    case Variant::INT:
+        // Lua only has floating point numbers
+        [[fallthrough]];
+
+    case Variant::FLOAT:
+        return push_number;
+
+    case Variant::STRING:
+        return push_string;
+
+    case Variant::STRING_NAME:
+        return push_string_name;
+
+    case Variant::VECTOR3:
+        return push_vector3;
+
+    default:
+        return push_variant;
+    }
+}
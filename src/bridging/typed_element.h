@@ -0,0 +1,24 @@
+#pragma once
+
+#include <godot_cpp/variant/variant.hpp>
+
+struct lua_State;
+
+namespace gdluau
+{
+    using namespace godot;
+
+    // Element conversions for typed Arrays and Dictionaries. The function for a container's element type
+    // is looked up once, so that converting each element doesn't dispatch on its type again.
+
+    // Reads the value at p_index as the element type, writing it to r_value.
+    // Returns false if the value can't be converted (strictly) to the element type.
+    typedef bool (*TypedElementReader)(lua_State *p_L, int p_index, Variant &r_value);
+
+    // Pushes a value that is known to be of the element type
+    typedef void (*TypedElementPusher)(lua_State *p_L, const Variant &p_value);
+
+    // Variant::NIL (an untyped container) reads and pushes any value, as to_variant and push_variant do
+    TypedElementReader get_typed_element_reader(Variant::Type p_type);
+    TypedElementPusher get_typed_element_pusher(Variant::Type p_type);
+} // namespace gdluau
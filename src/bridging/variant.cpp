@@ -4,6 +4,7 @@
 #include "bridging/callable.h"
 #include "bridging/dictionary.h"
 #include "bridging/object.h"
+#include "bridging/packed_array.h"
 #include "helpers.h"
 #include "lua_state.h"
 #include "string_cache.h"
@@ -13,6 +14,8 @@
 #include <lua.h>
 #include <lualib.h>
 
+#include <cstring>
+
 using namespace gdluau;
 using namespace godot;
 
@@ -36,93 +39,433 @@ static int variant_tostring(lua_State *L)
     return 1;
 }
 
+static bool has_variant_metatable(lua_State *L, int p_index);
+
+// Returns the Variant at p_index by reference if it is Variant userdata, otherwise converts it into r_storage.
+// The reference is only valid while the value stays on the stack.
+static const Variant &variant_operand(lua_State *L, int p_index, Variant &r_storage)
+{
+    if (lua_type(L, p_index) == LUA_TUSERDATA && has_variant_metatable(L, p_index)) [[likely]]
+    {
+        return *static_cast<const Variant *>(lua_touserdata(L, p_index));
+    }
+
+    r_storage = to_variant(L, p_index);
+    return r_storage;
+}
+
+// Fast paths for transforming vectors, which skip Variant::evaluate()
+template <Variant::Operator op>
+static bool variant_op_fast(lua_State *L)
+{
+    if constexpr (op == Variant::OP_MULTIPLY)
+    {
+        if (lua_type(L, 1) != LUA_TUSERDATA || !has_variant_metatable(L, 1))
+        {
+            return false;
+        }
+
+        const Variant &lhs = *static_cast<const Variant *>(lua_touserdata(L, 1));
+        if (const float *vec = lua_tovector(L, 2))
+        {
+            Vector3 v(vec[0], vec[1], vec[2]);
+            switch (lhs.get_type())
+            {
+            case Variant::TRANSFORM3D:
+            {
+                Transform3D xform = lhs;
+                v = xform.xform(v);
+                break;
+            }
+
+            case Variant::BASIS:
+            {
+                Basis basis = lhs;
+                v = basis.xform(v);
+                break;
+            }
+
+            case Variant::QUATERNION:
+            {
+                Quaternion quat = lhs;
+                v = quat.xform(v);
+                break;
+            }
+
+            default:
+                return false;
+            }
+
+            lua_pushvector(L, v.x, v.y, v.z);
+            return true;
+        }
+
+        if (lhs.get_type() == Variant::TRANSFORM2D && lua_type(L, 2) == LUA_TUSERDATA && has_variant_metatable(L, 2))
+        {
+            const Variant &rhs = *static_cast<const Variant *>(lua_touserdata(L, 2));
+            if (rhs.get_type() == Variant::VECTOR2)
+            {
+                Transform2D xform = lhs;
+                Vector2 vec = rhs;
+                push_variant(L, xform.xform(vec));
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 // Binary operators for Variant
 template <Variant::Operator op>
 static int variant_op(lua_State *L)
 {
-    Variant a = to_variant(L, 1);
-    Variant b = to_variant(L, 2);
-    lua_pop(L, 2);
+    if (variant_op_fast<op>(L)) [[likely]]
+    {
+        return 1;
+    }
 
-    Variant result;
     bool is_valid = false;
-    Variant::evaluate(op, a, b, result, is_valid);
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        Variant a_storage;
+        Variant b_storage;
+        const Variant &a = variant_operand(L, 1, a_storage);
+        const Variant &b = variant_operand(L, 2, b_storage);
+
+        Variant result;
+        Variant::evaluate(op, a, b, result, is_valid);
+
+        if (is_valid) [[likely]]
+        {
+            push_variant(L, result);
+        }
+        else
+        {
+            CharString error_msg = vformat("Cannot use operator %d on Variant types %s and %s", op, Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type())).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+        }
+    }
 
     if (!is_valid) [[unlikely]]
     {
-        String error_msg = vformat("Cannot use operator %d on Variant types %s and %s", op, Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-        lua_pushstring(L, error_msg.utf8().get_data());
         lua_error(L);
     }
 
-    push_variant(L, result);
     return 1;
 }
 
 // Variant.__unm metamethod
 static int variant_negate(lua_State *L)
 {
-    Variant var = *static_cast<Variant *>(lua_touserdata(L, 1));
-    lua_pop(L, 1);
-
-    Variant result;
     bool is_valid = false;
-    Variant::evaluate(Variant::OP_NEGATE, var, Variant(), result, is_valid);
+    {
+        const Variant &var = *static_cast<const Variant *>(lua_touserdata(L, 1));
+
+        Variant result;
+        Variant::evaluate(Variant::OP_NEGATE, var, Variant(), result, is_valid);
+
+        if (is_valid) [[likely]]
+        {
+            push_variant(L, result);
+        }
+        else
+        {
+            CharString error_msg = vformat("Cannot use negation operator on Variant type %s", Variant::get_type_name(var.get_type())).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+        }
+    }
 
     if (!is_valid) [[unlikely]]
     {
-        String error_msg = vformat("Cannot use negation operator on Variant type %s", Variant::OP_NEGATE, Variant::get_type_name(var.get_type()));
-        lua_pushstring(L, error_msg.utf8().get_data());
         lua_error(L);
     }
 
-    push_variant(L, result);
     return 1;
 }
 
+template <size_t N>
+static bool key_is(const char *p_key, size_t p_len, const char (&p_name)[N])
+{
+    return p_len == N - 1 && memcmp(p_key, p_name, N - 1) == 0;
+}
+
+// Index of a single-character component key within p_components (e.g. "xyzw"), or -1
+static int component_index(const char *p_key, size_t p_len, const char *p_components)
+{
+    if (p_len != 1)
+    {
+        return -1;
+    }
+
+    const char *found = strchr(p_components, p_key[0]);
+    return found ? static_cast<int>(found - p_components) : -1;
+}
+
+// Fast paths for reading the members of common geometry types, which skip Variant::get_named().
+// Returns false if the member isn't handled here.
+static bool push_member_fast(lua_State *L, const Variant &p_var, const char *p_key, size_t p_len)
+{
+    switch (p_var.get_type())
+    {
+    case Variant::VECTOR2:
+    {
+        int axis = component_index(p_key, p_len, "xy");
+        if (axis < 0)
+        {
+            return false;
+        }
+
+        Vector2 vec = p_var;
+        lua_pushnumber(L, vec[axis]);
+        return true;
+    }
+
+    case Variant::VECTOR2I:
+    {
+        int axis = component_index(p_key, p_len, "xy");
+        if (axis < 0)
+        {
+            return false;
+        }
+
+        Vector2i vec = p_var;
+        lua_pushnumber(L, vec[axis]);
+        return true;
+    }
+
+    case Variant::VECTOR3I:
+    {
+        int axis = component_index(p_key, p_len, "xyz");
+        if (axis < 0)
+        {
+            return false;
+        }
+
+        Vector3i vec = p_var;
+        lua_pushnumber(L, vec[axis]);
+        return true;
+    }
+
+    case Variant::VECTOR4:
+    {
+        int axis = component_index(p_key, p_len, "xyzw");
+        if (axis < 0)
+        {
+            return false;
+        }
+
+        Vector4 vec = p_var;
+        lua_pushnumber(L, vec[axis]);
+        return true;
+    }
+
+    case Variant::QUATERNION:
+    {
+        int axis = component_index(p_key, p_len, "xyzw");
+        if (axis < 0)
+        {
+            return false;
+        }
+
+        Quaternion quat = p_var;
+        lua_pushnumber(L, quat[axis]);
+        return true;
+    }
+
+    case Variant::COLOR:
+    {
+        int component = component_index(p_key, p_len, "rgba");
+        if (component < 0)
+        {
+            return false;
+        }
+
+        Color color = p_var;
+        lua_pushnumber(L, color[component]);
+        return true;
+    }
+
+    case Variant::RECT2:
+    {
+        Rect2 rect = p_var;
+        if (key_is(p_key, p_len, "position"))
+        {
+            push_variant(L, rect.position);
+            return true;
+        }
+        else if (key_is(p_key, p_len, "size"))
+        {
+            push_variant(L, rect.size);
+            return true;
+        }
+
+        return false;
+    }
+
+    case Variant::AABB:
+    {
+        godot::AABB aabb = p_var;
+        if (key_is(p_key, p_len, "position"))
+        {
+            lua_pushvector(L, aabb.position.x, aabb.position.y, aabb.position.z);
+            return true;
+        }
+        else if (key_is(p_key, p_len, "size"))
+        {
+            lua_pushvector(L, aabb.size.x, aabb.size.y, aabb.size.z);
+            return true;
+        }
+
+        return false;
+    }
+
+    case Variant::PLANE:
+    {
+        Plane plane = p_var;
+        if (key_is(p_key, p_len, "normal"))
+        {
+            lua_pushvector(L, plane.normal.x, plane.normal.y, plane.normal.z);
+            return true;
+        }
+        else if (key_is(p_key, p_len, "d"))
+        {
+            lua_pushnumber(L, plane.d);
+            return true;
+        }
+
+        return false;
+    }
+
+    case Variant::BASIS:
+    {
+        // Basis members are its columns
+        int axis = component_index(p_key, p_len, "xyz");
+        if (axis < 0)
+        {
+            return false;
+        }
+
+        Basis basis = p_var;
+        Vector3 column = basis.get_column(axis);
+        lua_pushvector(L, column.x, column.y, column.z);
+        return true;
+    }
+
+    case Variant::TRANSFORM2D:
+    {
+        int column = key_is(p_key, p_len, "origin") ? 2 : component_index(p_key, p_len, "xy");
+        if (column < 0)
+        {
+            return false;
+        }
+
+        Transform2D xform = p_var;
+        push_variant(L, xform.columns[column]);
+        return true;
+    }
+
+    case Variant::TRANSFORM3D:
+    {
+        Transform3D xform = p_var;
+        if (key_is(p_key, p_len, "origin"))
+        {
+            lua_pushvector(L, xform.origin.x, xform.origin.y, xform.origin.z);
+            return true;
+        }
+        else if (key_is(p_key, p_len, "basis"))
+        {
+            push_variant(L, xform.basis);
+            return true;
+        }
+
+        return false;
+    }
+
+    default:
+        return false;
+    }
+}
+
 // Variant.__index metamethod
 static int variant_index(lua_State *L)
 {
-    Variant var = *static_cast<Variant *>(lua_touserdata(L, 1));
-    Variant key = to_variant(L, 2);
-    lua_pop(L, 2);
+    const Variant &var = *static_cast<const Variant *>(lua_touserdata(L, 1));
+
+    size_t key_len = 0;
+    const char *key_str = lua_type(L, 2) == LUA_TSTRING ? lua_tolstring(L, 2, &key_len) : nullptr;
+    if (key_str && push_member_fast(L, var, key_str, key_len)) [[likely]]
+    {
+        return 1;
+    }
 
     bool is_valid = false;
-    Variant result = var.get(key, &is_valid);
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        Variant result;
+        if (key_str)
+        {
+            // Named members avoid converting the key into a String Variant
+            result = var.get_named(to_string_name(L, 2), is_valid);
+        }
+        else
+        {
+            result = var.get(to_variant(L, 2), &is_valid);
+        }
+
+        if (is_valid) [[likely]]
+        {
+            push_variant(L, result);
+        }
+        else
+        {
+            CharString error_msg = vformat("Cannot index Variant type %s with key of type %s", Variant::get_type_name(var.get_type()), luaL_typename(L, 2)).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+        }
+    }
 
     if (!is_valid) [[unlikely]]
     {
-        String error_msg = vformat("Cannot index Variant type %s with key of type %s", Variant::get_type_name(var.get_type()), Variant::get_type_name(key.get_type()));
-        lua_pushstring(L, error_msg.utf8().get_data());
         lua_error(L);
     }
 
-    push_variant(L, result);
     return 1;
 }
 
 // Variant.__newindex metamethod
 static int variant_newindex(lua_State *L)
 {
+    // Modifies the Variant in-place
     Variant *var = static_cast<Variant *>(lua_touserdata(L, 1));
-    Variant key = to_variant(L, 2);
-    Variant value = to_variant(L, 3);
-
-    // Leave the userdata on the stack, so we can modify the Variant in-place
-    lua_pop(L, 2);
 
     bool is_valid = false;
-    var->set(key, value, &is_valid);
+
+    // Scoped so that destructors run before any lua_error longjmp
+    {
+        Variant value = to_variant(L, 3);
+        if (lua_type(L, 2) == LUA_TSTRING)
+        {
+            var->set_named(to_string_name(L, 2), value, is_valid);
+        }
+        else
+        {
+            var->set(to_variant(L, 2), value, &is_valid);
+        }
+
+        if (!is_valid) [[unlikely]]
+        {
+            CharString error_msg = vformat("Cannot index Variant type %s with key of type %s", Variant::get_type_name(var->get_type()), luaL_typename(L, 2)).utf8();
+            lua_pushlstring(L, error_msg.get_data(), error_msg.length());
+        }
+    }
 
     if (!is_valid) [[unlikely]]
     {
-        String error_msg = vformat("Cannot index Variant type %s with key of type %s", Variant::get_type_name(var->get_type()), Variant::get_type_name(key.get_type()));
-        lua_pushstring(L, error_msg.utf8().get_data());
         lua_error(L);
     }
 
-    // Pop Variant userdata
-    lua_pop(L, 1);
     return 0;
 }
 
@@ -260,7 +603,137 @@ static bool has_variant_metatable(lua_State *L, int p_index)
     return mt_equal;
 }
 
-Variant gdluau::to_variant(lua_State *L, int p_index)
+// Converts a table to an Array if its keys are the sequence 1..n, or a Dictionary otherwise.
+// The keys are scanned first to choose between them, so each value is converted exactly once.
+static Variant table_to_variant(lua_State *L, int p_index, ConversionContext &r_context)
+{
+    ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 2), Variant(), vformat("to_variant(%d): Stack overflow. Cannot grow stack.", p_index));
+
+    int table_index = lua_absindex(L, p_index);
+    const void *table = lua_topointer(L, table_index);
+
+    bool in_progress = false;
+    if (const Variant *existing = r_context.find(table, in_progress))
+    {
+        // Already converted elsewhere in this conversion
+        return *existing;
+    }
+
+    ERR_FAIL_COND_V_MSG(in_progress, Variant(), vformat("to_variant(%d): Table refers back to a table that contains it. The reference is converted to null.", p_index));
+
+    ConversionContext::DepthGuard depth_guard(r_context);
+    ERR_FAIL_COND_V_MSG(depth_guard.exceeded(), Variant(), vformat("to_variant(%d): Tables are nested more than %d deep.", p_index, r_context.get_max_depth()));
+
+    r_context.begin(table);
+
+    // Only the keys are looked at here. Sequences are held in the table's array part, which is iterated first,
+    // so for a table with named fields this stops at the first one.
+    int count = 0;
+    bool is_array = true;
+    int iter = 0;
+    while ((iter = lua_rawiter(L, table_index, iter)) >= 0)
+    {
+        int isnum;
+        double num = lua_tonumberx(L, -2, &isnum);
+        lua_pop(L, 2); // Pop key and value
+
+        if (!isnum || nearbyint(num) != num || static_cast<int>(num) != count + 1)
+        {
+            // Found non-array portion of the table (or a hole)
+            is_array = false;
+            break;
+        }
+
+        count++;
+    }
+
+    if (is_array)
+    {
+        Array arr;
+        arr.resize(count);
+
+        iter = 0;
+        for (int i = 0; i < count; i++)
+        {
+            iter = lua_rawiter(L, table_index, iter);
+            arr[i] = to_variant(L, -1, r_context);
+            lua_pop(L, 2); // Pop key and value
+        }
+
+        r_context.finish(table, arr);
+        return arr;
+    }
+
+    Dictionary dict;
+
+    iter = 0;
+    while ((iter = lua_rawiter(L, table_index, iter)) >= 0)
+    {
+        Variant key = to_variant(L, -2, r_context);
+        Variant value = to_variant(L, -1, r_context);
+        lua_pop(L, 2);
+
+        dict[key] = value;
+    }
+
+    r_context.finish(table, dict);
+    return dict;
+}
+
+template <typename T>
+static Variant native_userdata_value(lua_State *L, int p_index)
+{
+    return *static_cast<const T *>(lua_touserdata(L, p_index));
+}
+
+// Reads the value wrapped by native userdata, given the type from get_native_userdata_type()
+static Variant native_userdata_to_variant(lua_State *L, int p_index, Variant::Type p_type)
+{
+    switch (p_type)
+    {
+    case Variant::ARRAY:
+        return native_userdata_value<Array>(L, p_index);
+
+    case Variant::DICTIONARY:
+        return native_userdata_value<Dictionary>(L, p_index);
+
+    case Variant::PACKED_BYTE_ARRAY:
+        return native_userdata_value<PackedByteArray>(L, p_index);
+
+    case Variant::PACKED_INT32_ARRAY:
+        return native_userdata_value<PackedInt32Array>(L, p_index);
+
+    case Variant::PACKED_INT64_ARRAY:
+        return native_userdata_value<PackedInt64Array>(L, p_index);
+
+    case Variant::PACKED_FLOAT32_ARRAY:
+        return native_userdata_value<PackedFloat32Array>(L, p_index);
+
+    case Variant::PACKED_FLOAT64_ARRAY:
+        return native_userdata_value<PackedFloat64Array>(L, p_index);
+
+    case Variant::PACKED_STRING_ARRAY:
+        return native_userdata_value<PackedStringArray>(L, p_index);
+
+    case Variant::PACKED_VECTOR2_ARRAY:
+        return native_userdata_value<PackedVector2Array>(L, p_index);
+
+    case Variant::PACKED_VECTOR3_ARRAY:
+        return native_userdata_value<PackedVector3Array>(L, p_index);
+
+    case Variant::PACKED_COLOR_ARRAY:
+        return native_userdata_value<PackedColorArray>(L, p_index);
+
+    case Variant::PACKED_VECTOR4_ARRAY:
+        return native_userdata_value<PackedVector4Array>(L, p_index);
+
+    default:
+        ERR_FAIL_V_MSG(Variant(), vformat("to_variant(%d): Unsupported native userdata type: %s", p_index, Variant::get_type_name(p_type)));
+    }
+}
+
+// p_context is only needed once a table is reached, so converting other values doesn't have to create one
+static Variant to_variant_impl(lua_State *L, int p_index, ConversionContext *p_context)
 {
     ERR_FAIL_COND_V_MSG(!is_valid_index(L, p_index), Variant(), vformat("to_variant(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
 
@@ -306,14 +779,13 @@ Variant gdluau::to_variant(lua_State *L, int p_index)
 
     case LUA_TTABLE:
     {
-        bool is_array = false;
-        Array arr = to_array(L, p_index, &is_array);
-        if (is_array)
-            return Variant(arr);
-        else
+        if (p_context)
         {
-            return Variant(to_dictionary(L, p_index));
+            return table_to_variant(L, p_index, *p_context);
         }
+
+        ConversionContext context;
+        return table_to_variant(L, p_index, context);
     }
 
     case LUA_TFUNCTION:
@@ -326,6 +798,13 @@ Variant gdluau::to_variant(lua_State *L, int p_index)
             return *static_cast<Variant *>(lua_touserdata(L, p_index));
         }
 
+        Variant::Type native_type = get_native_userdata_type(L, p_index);
+        if (native_type != Variant::NIL)
+        {
+            // Shares the wrapped container or array data rather than copying it
+            return native_userdata_to_variant(L, p_index, native_type);
+        }
+
         // __togodot is checked and possibly invoked above. Here we can assume it's full userdata.
         Object *obj = to_full_object(L, p_index);
         if (obj)
@@ -374,6 +853,16 @@ Variant gdluau::to_variant(lua_State *L, int p_index)
     }
 }
 
+Variant gdluau::to_variant(lua_State *L, int p_index)
+{
+    return to_variant_impl(L, p_index, nullptr);
+}
+
+Variant gdluau::to_variant(lua_State *L, int p_index, ConversionContext &r_context)
+{
+    return to_variant_impl(L, p_index, &r_context);
+}
+
 void gdluau::push_variant(lua_State *L, const Variant &p_variant)
 {
     ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "push_variant(): Stack overflow. Cannot grow stack."); // Variant + possible metatable
@@ -461,6 +950,35 @@ void gdluau::push_variant(lua_State *L, const Variant &p_variant)
         return;
     }
 
+    case Variant::PACKED_INT32_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_INT64_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_FLOAT32_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_FLOAT64_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_STRING_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_VECTOR2_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_VECTOR3_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_COLOR_ARRAY:
+        [[fallthrough]];
+
+    case Variant::PACKED_VECTOR4_ARRAY:
+        // Native userdata with in-place element access
+        push_packed_variant(L, p_variant);
+        return;
+
     default:
     {
         // For all other types (geometry, etc.), push as userdata
@@ -504,3 +1022,103 @@ bool gdluau::call_togodot_metamethod(lua_State *L, int p_index, Variant &r_resul
     r_result = callable.call(LuaState::find_or_create_lua_state(L), p_index, p_tag);
     return true;
 }
+
+String gdluau::describe_call_error(const String &p_callee, const GDExtensionCallError &p_error)
+{
+    switch (p_error.error)
+    {
+    case GDEXTENSION_CALL_OK:
+        return String();
+
+    case GDEXTENSION_CALL_ERROR_INVALID_METHOD:
+        return vformat("Invalid call to %s: method not found", p_callee);
+
+    case GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT:
+        return vformat("Invalid call to %s: argument %d should be %s", p_callee, p_error.argument + 1, Variant::get_type_name(static_cast<Variant::Type>(p_error.expected)));
+
+    case GDEXTENSION_CALL_ERROR_TOO_MANY_ARGUMENTS:
+        return vformat("Invalid call to %s: too many arguments (expected %d)", p_callee, p_error.expected);
+
+    case GDEXTENSION_CALL_ERROR_TOO_FEW_ARGUMENTS:
+        return vformat("Invalid call to %s: too few arguments (expected %d)", p_callee, p_error.expected);
+
+    case GDEXTENSION_CALL_ERROR_INSTANCE_IS_NULL:
+        return vformat("Invalid call to %s: instance is null", p_callee);
+
+    case GDEXTENSION_CALL_ERROR_METHOD_NOT_CONST:
+        return vformat("Invalid call to %s: method is not const", p_callee);
+
+    default:
+        return vformat("Invalid call to %s", p_callee);
+    }
+}
+
+const Variant *ConversionContext::find(const void *p_table, bool &r_in_progress) const
+{
+    const Entry *entry = converted.getptr(p_table);
+    if (!entry)
+    {
+        r_in_progress = false;
+        return nullptr;
+    }
+
+    r_in_progress = entry->in_progress;
+    return entry->in_progress ? nullptr : &entry->container;
+}
+
+void ConversionContext::begin(const void *p_table)
+{
+    converted.insert(p_table, Entry());
+}
+
+void ConversionContext::finish(const void *p_table, const Variant &p_container)
+{
+    Entry *entry = converted.getptr(p_table);
+    ERR_FAIL_NULL(entry);
+
+    entry->container = p_container;
+    entry->in_progress = false;
+}
+
+StackVariantArgs::StackVariantArgs(lua_State *L, int p_first_index, int p_count, const Variant *p_leading)
+    : count(p_count + (p_leading ? 1 : 0))
+{
+    if (count <= INLINE_CAPACITY) [[likely]]
+    {
+        args = reinterpret_cast<Variant *>(inline_args);
+        argptrs = inline_argptrs;
+    }
+    else
+    {
+        args = static_cast<Variant *>(memalloc(count * sizeof(Variant)));
+        argptrs = static_cast<const Variant **>(memalloc(count * sizeof(const Variant *)));
+    }
+
+    int slot = 0;
+    if (p_leading)
+    {
+        memnew_placement(&args[slot], Variant(*p_leading));
+        argptrs[slot] = &args[slot];
+        slot++;
+    }
+
+    for (int i = 0; i < p_count; i++, slot++)
+    {
+        memnew_placement(&args[slot], Variant(to_variant(L, p_first_index + i)));
+        argptrs[slot] = &args[slot];
+    }
+}
+
+StackVariantArgs::~StackVariantArgs()
+{
+    for (int i = 0; i < count; i++)
+    {
+        args[i].~Variant();
+    }
+
+    if (args != reinterpret_cast<Variant *>(inline_args)) [[unlikely]]
+    {
+        memfree(args);
+        memfree(argptrs);
+    }
+}
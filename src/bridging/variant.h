@@ -1,5 +1,6 @@
 #pragma once
 
+#include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 struct lua_State;
@@ -8,8 +9,92 @@ namespace gdluau
 {
     using namespace godot;
 
+    // State shared across one deep conversion from Lua. Each table is converted once, and remembered by its
+    // address: a table referenced more than once becomes the same Array or Dictionary each time, so aliasing is
+    // preserved and shared structure isn't converted again. A table that refers back to one still being converted
+    // (a cycle) is converted to null instead, since a container holding itself would never be freed. Tables
+    // nested deeper than the maximum depth fail to convert.
+    class ConversionContext
+    {
+    public:
+        static constexpr int DEFAULT_MAX_DEPTH = 256;
+
+        explicit ConversionContext(int p_max_depth = DEFAULT_MAX_DEPTH) : max_depth(p_max_depth) {}
+
+        ConversionContext(const ConversionContext &) = delete;
+        ConversionContext &operator=(const ConversionContext &) = delete;
+
+        // Returns the container converted from p_table, or nullptr if it hasn't been converted.
+        // r_in_progress is set if p_table is still being converted further up, i.e. the reference is a cycle.
+        const Variant *find(const void *p_table, bool &r_in_progress) const;
+
+        // Marks p_table as being converted, until finish() records its container
+        void begin(const void *p_table);
+        void finish(const void *p_table, const Variant &p_container);
+
+        int get_max_depth() const { return max_depth; }
+
+        // Tracks the nesting depth while a table is being converted
+        class DepthGuard
+        {
+        public:
+            explicit DepthGuard(ConversionContext &p_context) : context(p_context) { context.depth++; }
+            ~DepthGuard() { context.depth--; }
+
+            DepthGuard(const DepthGuard &) = delete;
+            DepthGuard &operator=(const DepthGuard &) = delete;
+
+            bool exceeded() const { return context.depth > context.max_depth; }
+
+        private:
+            ConversionContext &context;
+        };
+
+    private:
+        struct Entry
+        {
+            Variant container;
+            bool in_progress = true;
+        };
+
+        HashMap<const void *, Entry> converted;
+
+        int depth = 0;
+        int max_depth;
+    };
+
     Variant to_variant(lua_State *p_L, int p_index);
+    Variant to_variant(lua_State *p_L, int p_index, ConversionContext &r_context);
     void push_variant(lua_State *p_L, const Variant &p_variant);
 
     bool call_togodot_metamethod(lua_State *p_L, int p_index, Variant &r_result, int p_tag = 0);
+
+    // Describes a failed Godot call, for use in Lua error messages
+    String describe_call_error(const String &p_callee, const GDExtensionCallError &p_error);
+
+    // Arguments for a Godot call, converted from consecutive Lua stack values.
+    // Short argument lists are stored inline, so that call paths don't allocate.
+    class StackVariantArgs
+    {
+    public:
+        static constexpr int INLINE_CAPACITY = 8;
+
+        // p_leading, if given, is passed before the Lua values
+        StackVariantArgs(lua_State *p_L, int p_first_index, int p_count, const Variant *p_leading = nullptr);
+        ~StackVariantArgs();
+
+        StackVariantArgs(const StackVariantArgs &) = delete;
+        StackVariantArgs &operator=(const StackVariantArgs &) = delete;
+
+        const Variant **ptrs() { return argptrs; }
+        int size() const { return count; }
+
+    private:
+        alignas(Variant) uint8_t inline_args[INLINE_CAPACITY * sizeof(Variant)];
+        const Variant *inline_argptrs[INLINE_CAPACITY];
+
+        Variant *args;
+        const Variant **argptrs;
+        int count;
+    };
 } // namespace gdluau
@@ -0,0 +1,103 @@
+#include "bytecode_cache.h"
+
+#include "lua_compileoptions.h"
+
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+
+using namespace gdluau;
+using namespace godot;
+
+#ifndef GDLUAU_LUAU_VERSION
+#define GDLUAU_LUAU_VERSION "unknown"
+#endif
+
+// Bump whenever the entry layout or key derivation changes
+static constexpr uint32_t CACHE_FORMAT_VERSION = 2;
+static constexpr uint32_t CACHE_MAGIC = 0x4342554C; // "LUBC"
+
+static bool cache_enabled = false;
+
+void gdluau::initialize_bytecode_cache(bool p_enabled)
+{
+    cache_enabled = p_enabled;
+}
+
+bool gdluau::is_bytecode_cache_enabled()
+{
+    return cache_enabled;
+}
+
+String gdluau::get_bytecode_cache_dir()
+{
+    OS *os = OS::get_singleton();
+    return os && os->has_feature("editor") ? "res://.godot/luau_cache" : "user://luau_cache";
+}
+
+String gdluau::get_bytecode_cache_key(const String &p_source_code, const LuaCompileOptions *p_options)
+{
+    String header = vformat("%d|%s|%s|", static_cast<int64_t>(CACHE_FORMAT_VERSION), GDLUAU_LUAU_VERSION, LuaCompileOptions::fingerprint(p_options));
+    return (header + p_source_code).sha256_text();
+}
+
+static String get_entry_path(const String &p_key)
+{
+    return get_bytecode_cache_dir().path_join(p_key + ".bin");
+}
+
+bool gdluau::load_cached_bytecode(const String &p_key, PackedByteArray &r_bytecode)
+{
+    Ref<FileAccess> file = FileAccess::open(get_entry_path(p_key), FileAccess::READ);
+    if (file.is_null())
+    {
+        return false;
+    }
+
+    if (file->get_32() != CACHE_MAGIC || file->get_32() != CACHE_FORMAT_VERSION)
+    {
+        return false;
+    }
+
+    // A truncated write leaves fewer bytes than the header promises
+    uint32_t size = file->get_32();
+    if (size == 0 || file->get_length() - file->get_position() != size)
+    {
+        return false;
+    }
+
+    r_bytecode = file->get_buffer(size);
+    return true;
+}
+
+void gdluau::store_cached_bytecode(const String &p_key, const PackedByteArray &p_bytecode)
+{
+    ERR_FAIL_COND_MSG(p_bytecode.is_empty(), "store_cached_bytecode(): Bytecode is empty.");
+
+    String dir = get_bytecode_cache_dir();
+    Error err = DirAccess::make_dir_recursive_absolute(dir);
+    ERR_FAIL_COND_MSG(err != OK, vformat("store_cached_bytecode(): Cannot create cache directory '%s'.", dir));
+
+    // Write to a temporary file first, so readers never observe a partial entry. The name is unique
+    // to this thread, as scripts with the same source can be compiled and stored concurrently.
+    String path = get_entry_path(p_key);
+    String temp_path = vformat("%s.%d.tmp", path, static_cast<int64_t>(OS::get_singleton()->get_thread_caller_id()));
+    {
+        Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE);
+        ERR_FAIL_COND_MSG(file.is_null(), vformat("store_cached_bytecode(): Cannot write cache entry '%s'.", temp_path));
+
+        file->store_32(CACHE_MAGIC);
+        file->store_32(CACHE_FORMAT_VERSION);
+        file->store_32(static_cast<uint32_t>(p_bytecode.size()));
+        file->store_buffer(p_bytecode);
+        file->close();
+    }
+
+    err = DirAccess::rename_absolute(temp_path, path);
+    if (err != OK)
+    {
+        DirAccess::remove_absolute(temp_path);
+        ERR_FAIL_MSG(vformat("store_cached_bytecode(): Cannot move cache entry into place at '%s'.", path));
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+namespace gdluau
+{
+    using namespace godot;
+
+    // On-disk cache of compiled bytecode, so unchanged scripts are not recompiled on every launch.
+    // Entries are content-addressed: the key is a hash of the source, every compile option that
+    // affects the output, and the Luau version, so stale entries are never returned, only orphaned.
+
+    void initialize_bytecode_cache(bool p_enabled);
+
+    bool is_bytecode_cache_enabled();
+
+    // res://.godot/luau_cache/ when running from an editor build, user://luau_cache/ otherwise
+    String get_bytecode_cache_dir();
+
+    class LuaCompileOptions;
+
+    // Null options are the defaults, as with Luau::compile
+    String get_bytecode_cache_key(const String &p_source_code, const LuaCompileOptions *p_options);
+
+    // Returns false (leaving r_bytecode untouched) if there is no valid entry for the key
+    bool load_cached_bytecode(const String &p_key, PackedByteArray &r_bytecode);
+    void store_cached_bytecode(const String &p_key, const PackedByteArray &p_bytecode);
+} // namespace gdluau
@@ -0,0 +1,124 @@
+#include "editor/luau_export_plugin.h"
+
+#include "lua_compileoptions.h"
+#include "luau.h"
+#include "luau_script.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+
+using namespace gdluau;
+using namespace godot;
+
+static const char *const OPTION_PRECOMPILE = "luau/precompile_scripts";
+
+// Every LuaCompileOptions property is an export option named luau/<property>, so that precompiled
+// scripts can be built with the same options the game would otherwise compile them with
+struct CompileOptionInfo
+{
+    const char *property;
+    Variant::Type type;
+    PropertyHint hint;
+    const char *hint_string;
+};
+
+static const CompileOptionInfo COMPILE_OPTIONS[] = {
+    {"optimization_level", Variant::INT, PROPERTY_HINT_RANGE, "0,2,1"},
+    {"debug_level", Variant::INT, PROPERTY_HINT_RANGE, "0,2,1"},
+    {"type_info_level", Variant::INT, PROPERTY_HINT_RANGE, "0,1,1"},
+    {"coverage_level", Variant::INT, PROPERTY_HINT_RANGE, "0,2,1"},
+    {"native_codegen", Variant::BOOL, PROPERTY_HINT_NONE, ""},
+    {"vector_lib", Variant::STRING, PROPERTY_HINT_NONE, ""},
+    {"vector_ctor", Variant::STRING, PROPERTY_HINT_NONE, ""},
+    {"vector_type", Variant::STRING, PROPERTY_HINT_NONE, ""},
+    {"mutable_globals", Variant::PACKED_STRING_ARRAY, PROPERTY_HINT_NONE, ""},
+    {"userdata_types", Variant::PACKED_STRING_ARRAY, PROPERTY_HINT_NONE, ""},
+    {"library_constants", Variant::DICTIONARY, PROPERTY_HINT_NONE, ""},
+    {"library_member_types", Variant::DICTIONARY, PROPERTY_HINT_NONE, ""},
+};
+
+static String get_compile_option_name(const CompileOptionInfo &p_info)
+{
+    return String("luau/") + p_info.property;
+}
+
+static Dictionary make_export_option(const String &p_name, Variant::Type p_type, const Variant &p_default, PropertyHint p_hint = PROPERTY_HINT_NONE, const String &p_hint_string = String())
+{
+    Dictionary option;
+    option["name"] = p_name;
+    option["type"] = p_type;
+    option["hint"] = p_hint;
+    option["hint_string"] = p_hint_string;
+
+    Dictionary result;
+    result["option"] = option;
+    result["default_value"] = p_default;
+    return result;
+}
+
+String LuauExportPlugin::_get_name() const
+{
+    return "Luau";
+}
+
+TypedArray<Dictionary> LuauExportPlugin::_get_export_options(const Ref<EditorExportPlatform> &p_platform) const
+{
+    Ref<LuaCompileOptions> defaults;
+    defaults.instantiate();
+    Dictionary default_values = defaults->to_dictionary();
+
+    TypedArray<Dictionary> options;
+    options.push_back(make_export_option(OPTION_PRECOMPILE, Variant::BOOL, true));
+    for (const CompileOptionInfo &info : COMPILE_OPTIONS)
+    {
+        options.push_back(make_export_option(get_compile_option_name(info), info.type, default_values[info.property], info.hint, info.hint_string));
+    }
+    return options;
+}
+
+void LuauExportPlugin::_export_file(const String &p_path, const String &p_type, const PackedStringArray &p_features)
+{
+    String extension = p_path.get_extension().to_lower();
+    if ((extension != "lua" && extension != "luau") || !static_cast<bool>(get_option(OPTION_PRECOMPILE)))
+    {
+        return;
+    }
+
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+    ERR_FAIL_COND_MSG(file.is_null(), vformat("Cannot open Luau script file '%s' for export.", p_path));
+
+    String source = file->get_as_text();
+    file->close();
+
+    Dictionary values;
+    for (const CompileOptionInfo &info : COMPILE_OPTIONS)
+    {
+        values[info.property] = get_option(get_compile_option_name(info));
+    }
+    Ref<LuaCompileOptions> options = LuaCompileOptions::from_dictionary(values);
+
+    PackedByteArray bytecode = Luau::compile(source, options.ptr());
+
+    // Luau encodes compile errors as a zero byte followed by the message
+    if (bytecode.is_empty() || bytecode[0] == 0)
+    {
+        String message = bytecode.size() > 1 ? bytecode.slice(1).get_string_from_utf8() : String("unknown error");
+        ERR_FAIL_MSG(vformat("Cannot precompile Luau script '%s', exporting its source instead: %s", p_path, message));
+    }
+
+    // Remapped, so loading the original path in the exported project loads the .luauc file instead.
+    // The original extension is kept, so foo.lua and foo.luau in the same folder don't collide.
+    add_file(p_path + ".luauc", encode_precompiled_script(bytecode, options.ptr()), true);
+}
+
+void LuauEditorPlugin::_enter_tree()
+{
+    export_plugin.instantiate();
+    add_export_plugin(export_plugin);
+}
+
+void LuauEditorPlugin::_exit_tree()
+{
+    remove_export_plugin(export_plugin);
+    export_plugin.unref();
+}
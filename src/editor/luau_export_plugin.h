@@ -0,0 +1,40 @@
+#pragma once
+
+#include <godot_cpp/classes/editor_export_plugin.hpp>
+#include <godot_cpp/classes/editor_plugin.hpp>
+
+namespace gdluau
+{
+    using namespace godot;
+
+    // Replaces .lua/.luau scripts with precompiled .luauc bytecode in exported projects,
+    // so shipping builds never run the Luau compiler.
+    class LuauExportPlugin : public EditorExportPlugin
+    {
+        GDCLASS(LuauExportPlugin, EditorExportPlugin)
+
+    protected:
+        static void _bind_methods() {}
+
+    public:
+        virtual String _get_name() const override;
+        virtual TypedArray<Dictionary> _get_export_options(const Ref<EditorExportPlatform> &p_platform) const override;
+        virtual void _export_file(const String &p_path, const String &p_type, const PackedStringArray &p_features) override;
+    };
+
+    // Editor plugin that installs LuauExportPlugin
+    class LuauEditorPlugin : public EditorPlugin
+    {
+        GDCLASS(LuauEditorPlugin, EditorPlugin)
+
+    private:
+        Ref<LuauExportPlugin> export_plugin;
+
+    protected:
+        static void _bind_methods() {}
+
+    public:
+        virtual void _enter_tree() override;
+        virtual void _exit_tree() override;
+    };
+} // namespace gdluau
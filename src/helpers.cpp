@@ -64,3 +64,27 @@ StringName gdluau::to_string_name(lua_State *L, int p_index)
         return cached;
     }
 }
+
+void gdluau::register_native_userdata_metatable(lua_State *L, Variant::Type p_type)
+{
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, 2), "register_native_userdata_metatable(): Stack overflow. Cannot grow stack.");
+
+    // registry[metatable] = Variant type
+    lua_pushvalue(L, -1);
+    lua_pushinteger(L, p_type);
+    lua_rawset(L, LUA_REGISTRYINDEX);
+}
+
+Variant::Type gdluau::get_native_userdata_type(lua_State *L, int p_index)
+{
+    if (lua_type(L, p_index) != LUA_TUSERDATA || !lua_checkstack(L, 1) || !lua_getmetatable(L, p_index))
+    {
+        return Variant::NIL;
+    }
+
+    lua_rawget(L, LUA_REGISTRYINDEX);
+    Variant::Type type = lua_isnumber(L, -1) ? static_cast<Variant::Type>(lua_tointeger(L, -1)) : Variant::NIL;
+    lua_pop(L, 1);
+
+    return type;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/variant.hpp>
 
 struct lua_State;
 
@@ -15,4 +16,12 @@ namespace gdluau
 
     bool is_valid_index(lua_State *p_L, int p_index);
     StringName to_string_name(lua_State *p_L, int p_index);
+
+    // Metatables of userdata that wraps a single Godot value (packed arrays, container proxies, buffer views)
+    // are registered against that value's Variant type, so any of them is identified with one registry lookup.
+    // Registers the metatable at the top of the stack.
+    void register_native_userdata_metatable(lua_State *p_L, Variant::Type p_type);
+
+    // Returns the Variant type held by the native userdata at p_index, or NIL if it isn't native userdata
+    Variant::Type get_native_userdata_type(lua_State *p_L, int p_index);
 } // namespace gdluau
@@ -1,11 +1,49 @@
 #include "lua_compileoptions.h"
 
+#include <godot_cpp/variant/utility_functions.hpp>
+#include <Luau/Bytecode.h>
+
 using namespace gdluau;
 using namespace godot;
 
+// Options whose library members the compiler callbacks should consult, per compiling thread
+static thread_local const LuaCompileOptions *compiling_options = nullptr;
+
+LuaCompileOptions::CompileScope::CompileScope(const LuaCompileOptions *p_options)
+    : previous(compiling_options)
+{
+    compiling_options = p_options;
+}
+
+LuaCompileOptions::CompileScope::~CompileScope()
+{
+    compiling_options = previous;
+}
+
+void LuaCompileOptions::CStringList::set(const PackedStringArray &p_strings)
+{
+    strings.clear();
+    pointers.clear();
+
+    for (const String &string : p_strings)
+    {
+        strings.push_back(string.utf8());
+    }
+
+    for (const CharString &string : strings)
+    {
+        pointers.push_back(string.get_data());
+    }
+
+    pointers.push_back(nullptr);
+}
+
 LuaCompileOptions::LuaCompileOptions()
     : options{default_options()}
 {
+    // Own copies of the default strings, so that the getters and setters agree with the options
+    set_vector_ctor(options.vectorCtor);
+    set_vector_type(options.vectorType);
 }
 
 void LuaCompileOptions::_bind_methods()
@@ -22,10 +60,42 @@ void LuaCompileOptions::_bind_methods()
     ClassDB::bind_method(D_METHOD("set_coverage_level", "level"), &LuaCompileOptions::set_coverage_level);
     ClassDB::bind_method(D_METHOD("get_coverage_level"), &LuaCompileOptions::get_coverage_level);
 
+    ClassDB::bind_method(D_METHOD("set_native_codegen", "enabled"), &LuaCompileOptions::set_native_codegen);
+    ClassDB::bind_method(D_METHOD("get_native_codegen"), &LuaCompileOptions::get_native_codegen);
+
+    ClassDB::bind_method(D_METHOD("set_vector_lib", "name"), &LuaCompileOptions::set_vector_lib);
+    ClassDB::bind_method(D_METHOD("get_vector_lib"), &LuaCompileOptions::get_vector_lib);
+
+    ClassDB::bind_method(D_METHOD("set_vector_ctor", "name"), &LuaCompileOptions::set_vector_ctor);
+    ClassDB::bind_method(D_METHOD("get_vector_ctor"), &LuaCompileOptions::get_vector_ctor);
+
+    ClassDB::bind_method(D_METHOD("set_vector_type", "name"), &LuaCompileOptions::set_vector_type);
+    ClassDB::bind_method(D_METHOD("get_vector_type"), &LuaCompileOptions::get_vector_type);
+
+    ClassDB::bind_method(D_METHOD("set_mutable_globals", "names"), &LuaCompileOptions::set_mutable_globals);
+    ClassDB::bind_method(D_METHOD("get_mutable_globals"), &LuaCompileOptions::get_mutable_globals);
+
+    ClassDB::bind_method(D_METHOD("set_userdata_types", "names"), &LuaCompileOptions::set_userdata_types);
+    ClassDB::bind_method(D_METHOD("get_userdata_types"), &LuaCompileOptions::get_userdata_types);
+
+    ClassDB::bind_method(D_METHOD("set_library_constants", "constants"), &LuaCompileOptions::set_library_constants);
+    ClassDB::bind_method(D_METHOD("get_library_constants"), &LuaCompileOptions::get_library_constants);
+
+    ClassDB::bind_method(D_METHOD("set_library_member_types", "types"), &LuaCompileOptions::set_library_member_types);
+    ClassDB::bind_method(D_METHOD("get_library_member_types"), &LuaCompileOptions::get_library_member_types);
+
     ADD_PROPERTY(PropertyInfo(Variant::INT, "optimization_level"), "set_optimization_level", "get_optimization_level");
     ADD_PROPERTY(PropertyInfo(Variant::INT, "debug_level"), "set_debug_level", "get_debug_level");
     ADD_PROPERTY(PropertyInfo(Variant::INT, "type_info_level"), "set_type_info_level", "get_type_info_level");
     ADD_PROPERTY(PropertyInfo(Variant::INT, "coverage_level"), "set_coverage_level", "get_coverage_level");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "native_codegen"), "set_native_codegen", "get_native_codegen");
+    ADD_PROPERTY(PropertyInfo(Variant::STRING, "vector_lib"), "set_vector_lib", "get_vector_lib");
+    ADD_PROPERTY(PropertyInfo(Variant::STRING, "vector_ctor"), "set_vector_ctor", "get_vector_ctor");
+    ADD_PROPERTY(PropertyInfo(Variant::STRING, "vector_type"), "set_vector_type", "get_vector_type");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_STRING_ARRAY, "mutable_globals"), "set_mutable_globals", "get_mutable_globals");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_STRING_ARRAY, "userdata_types"), "set_userdata_types", "get_userdata_types");
+    ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "library_constants"), "set_library_constants", "get_library_constants");
+    ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "library_member_types"), "set_library_member_types", "get_library_member_types");
 }
 
 void LuaCompileOptions::set_optimization_level(int p_level)
@@ -67,3 +137,352 @@ int LuaCompileOptions::get_coverage_level() const
 {
     return options.coverageLevel;
 }
+
+void LuaCompileOptions::set_native_codegen(bool p_enabled)
+{
+    native_codegen = p_enabled;
+}
+
+bool LuaCompileOptions::get_native_codegen() const
+{
+    return native_codegen;
+}
+
+// An empty name leaves the option unset, rather than pointing it at an empty string
+static const char *optional_name(const String &p_name, CharString &r_utf8)
+{
+    r_utf8 = p_name.utf8();
+    return p_name.is_empty() ? nullptr : r_utf8.get_data();
+}
+
+void LuaCompileOptions::set_vector_lib(const String &p_name)
+{
+    vector_lib = p_name;
+    options.vectorLib = optional_name(vector_lib, vector_lib_utf8);
+}
+
+String LuaCompileOptions::get_vector_lib() const
+{
+    return vector_lib;
+}
+
+void LuaCompileOptions::set_vector_ctor(const String &p_name)
+{
+    vector_ctor = p_name;
+    options.vectorCtor = optional_name(vector_ctor, vector_ctor_utf8);
+}
+
+String LuaCompileOptions::get_vector_ctor() const
+{
+    return vector_ctor;
+}
+
+void LuaCompileOptions::set_vector_type(const String &p_name)
+{
+    vector_type = p_name;
+    options.vectorType = optional_name(vector_type, vector_type_utf8);
+}
+
+String LuaCompileOptions::get_vector_type() const
+{
+    return vector_type;
+}
+
+void LuaCompileOptions::set_mutable_globals(const PackedStringArray &p_names)
+{
+    mutable_globals = p_names;
+    mutable_globals_list.set(mutable_globals);
+    options.mutableGlobals = mutable_globals_list.get();
+}
+
+PackedStringArray LuaCompileOptions::get_mutable_globals() const
+{
+    return mutable_globals;
+}
+
+void LuaCompileOptions::set_userdata_types(const PackedStringArray &p_names)
+{
+    userdata_types = p_names;
+    userdata_types_list.set(userdata_types);
+    options.userdataTypes = userdata_types_list.get();
+}
+
+PackedStringArray LuaCompileOptions::get_userdata_types() const
+{
+    return userdata_types;
+}
+
+void LuaCompileOptions::set_library_constants(const Dictionary &p_constants)
+{
+    library_constants = p_constants.duplicate(true);
+    update_library_members();
+}
+
+Dictionary LuaCompileOptions::get_library_constants() const
+{
+    return library_constants.duplicate(true);
+}
+
+void LuaCompileOptions::set_library_member_types(const Dictionary &p_types)
+{
+    library_member_types = p_types.duplicate(true);
+    update_library_members();
+}
+
+Dictionary LuaCompileOptions::get_library_member_types() const
+{
+    return library_member_types.duplicate(true);
+}
+
+// How the bridging layer represents a value of the given type in Luau
+static int get_bytecode_type(Variant::Type p_type)
+{
+    switch (p_type)
+    {
+    case Variant::NIL:
+        return LBC_TYPE_NIL;
+    case Variant::BOOL:
+        return LBC_TYPE_BOOLEAN;
+    case Variant::INT:
+    case Variant::FLOAT:
+        return LBC_TYPE_NUMBER;
+    case Variant::STRING:
+    case Variant::STRING_NAME:
+        return LBC_TYPE_STRING;
+    case Variant::VECTOR3:
+        return LBC_TYPE_VECTOR;
+    case Variant::ARRAY:
+    case Variant::DICTIONARY:
+        return LBC_TYPE_TABLE;
+    case Variant::CALLABLE:
+        // Godot Callables are pushed as GDCallable userdata, not Lua functions
+        return LBC_TYPE_USERDATA;
+    case Variant::PACKED_BYTE_ARRAY:
+        return LBC_TYPE_BUFFER;
+    case Variant::OBJECT:
+        return LBC_TYPE_USERDATA;
+    default:
+        return LBC_TYPE_ANY;
+    }
+}
+
+static bool is_foldable_constant(const Variant &p_value)
+{
+    switch (p_value.get_type())
+    {
+    case Variant::NIL:
+    case Variant::BOOL:
+    case Variant::INT:
+    case Variant::FLOAT:
+    case Variant::STRING:
+    case Variant::STRING_NAME:
+    case Variant::VECTOR3:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void LuaCompileOptions::update_library_members()
+{
+    library_members.clear();
+
+    PackedStringArray libraries;
+    Array type_libraries = library_member_types.keys();
+    for (const Variant &library : type_libraries)
+    {
+        ERR_CONTINUE_MSG(library.get_type() != Variant::STRING, "set_library_member_types(): Library names must be Strings.");
+        ERR_CONTINUE_MSG(library_member_types[library].get_type() != Variant::DICTIONARY, vformat("set_library_member_types(): Members of library '%s' must be a Dictionary.", library));
+
+        Dictionary members = library_member_types[library];
+        Array names = members.keys();
+        for (const Variant &name : names)
+        {
+            Variant type = members[name];
+            ERR_CONTINUE_MSG(type.get_type() != Variant::INT || static_cast<int64_t>(type) < 0 || static_cast<int64_t>(type) >= Variant::VARIANT_MAX, vformat("set_library_member_types(): Type of '%s.%s' must be a Variant.Type.", library, name));
+
+            LibraryMember member;
+            member.type = get_bytecode_type(static_cast<Variant::Type>(static_cast<int64_t>(type)));
+            library_members.insert(vformat("%s.%s", library, name), member);
+        }
+
+        libraries.push_back(library);
+    }
+
+    // Constants take precedence, and imply their own type
+    Array constant_libraries = library_constants.keys();
+    for (const Variant &library : constant_libraries)
+    {
+        ERR_CONTINUE_MSG(library.get_type() != Variant::STRING, "set_library_constants(): Library names must be Strings.");
+        ERR_CONTINUE_MSG(library_constants[library].get_type() != Variant::DICTIONARY, vformat("set_library_constants(): Members of library '%s' must be a Dictionary.", library));
+
+        Dictionary members = library_constants[library];
+        Array names = members.keys();
+        for (const Variant &name : names)
+        {
+            Variant value = members[name];
+            ERR_CONTINUE_MSG(!is_foldable_constant(value), vformat("set_library_constants(): Cannot fold '%s.%s' of type %s. Constants must be null, bool, int, float, String or Vector3.", library, name, Variant::get_type_name(value.get_type())));
+
+            LibraryMember member;
+            member.type = get_bytecode_type(value.get_type());
+            member.is_constant = true;
+            member.constant = value;
+            if (value.get_type() == Variant::STRING || value.get_type() == Variant::STRING_NAME)
+            {
+                member.string_constant = String(value).utf8();
+            }
+
+            library_members.insert(vformat("%s.%s", library, name), member);
+        }
+
+        if (!libraries.has(library))
+        {
+            libraries.push_back(library);
+        }
+    }
+
+    known_libraries_list.set(libraries);
+    options.librariesWithKnownMembers = known_libraries_list.get();
+    options.libraryMemberTypeCb = libraries.is_empty() ? nullptr : &LuaCompileOptions::library_member_type_cb;
+    options.libraryMemberConstantCb = libraries.is_empty() ? nullptr : &LuaCompileOptions::library_member_constant_cb;
+}
+
+const LuaCompileOptions::LibraryMember *LuaCompileOptions::find_library_member(const char *p_library, const char *p_member) const
+{
+    HashMap<String, LibraryMember>::ConstIterator E = library_members.find(String::utf8(p_library) + "." + String::utf8(p_member));
+    return E ? &E->value : nullptr;
+}
+
+int LuaCompileOptions::library_member_type_cb(const char *p_library, const char *p_member)
+{
+    const LibraryMember *member = compiling_options ? compiling_options->find_library_member(p_library, p_member) : nullptr;
+    return member ? member->type : LBC_TYPE_ANY;
+}
+
+void LuaCompileOptions::library_member_constant_cb(const char *p_library, const char *p_member, lua_CompileConstant *p_constant)
+{
+    const LibraryMember *member = compiling_options ? compiling_options->find_library_member(p_library, p_member) : nullptr;
+    if (!member || !member->is_constant)
+    {
+        // Leaving the constant unset tells the compiler the member is not constant
+        return;
+    }
+
+    const Variant &value = member->constant;
+    switch (value.get_type())
+    {
+    case Variant::NIL:
+        luau_set_compile_constant_nil(p_constant);
+        break;
+    case Variant::BOOL:
+        luau_set_compile_constant_boolean(p_constant, static_cast<bool>(value));
+        break;
+    case Variant::INT:
+    case Variant::FLOAT:
+        luau_set_compile_constant_number(p_constant, static_cast<double>(value));
+        break;
+    case Variant::STRING:
+    case Variant::STRING_NAME:
+        luau_set_compile_constant_string(p_constant, member->string_constant.get_data(), member->string_constant.length());
+        break;
+    case Variant::VECTOR3:
+    {
+        Vector3 vector = value;
+        luau_set_compile_constant_vector(p_constant, vector.x, vector.y, vector.z, 0.0f);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+Dictionary LuaCompileOptions::to_dictionary() const
+{
+    Dictionary result;
+    result["optimization_level"] = get_optimization_level();
+    result["debug_level"] = get_debug_level();
+    result["type_info_level"] = get_type_info_level();
+    result["coverage_level"] = get_coverage_level();
+    result["native_codegen"] = get_native_codegen();
+    result["vector_lib"] = get_vector_lib();
+    result["vector_ctor"] = get_vector_ctor();
+    result["vector_type"] = get_vector_type();
+    result["mutable_globals"] = get_mutable_globals();
+    result["userdata_types"] = get_userdata_types();
+    result["library_constants"] = get_library_constants();
+    result["library_member_types"] = get_library_member_types();
+    return result;
+}
+
+Ref<LuaCompileOptions> LuaCompileOptions::from_dictionary(const Dictionary &p_options)
+{
+    // Missing keys keep their defaults
+    Ref<LuaCompileOptions> options;
+    options.instantiate();
+
+    Dictionary defaults = options->to_dictionary();
+    Dictionary values = defaults.merged(p_options, true);
+
+    options->set_optimization_level(values["optimization_level"]);
+    options->set_debug_level(values["debug_level"]);
+    options->set_type_info_level(values["type_info_level"]);
+    options->set_coverage_level(values["coverage_level"]);
+    options->set_native_codegen(values["native_codegen"]);
+    options->set_vector_lib(values["vector_lib"]);
+    options->set_vector_ctor(values["vector_ctor"]);
+    options->set_vector_type(values["vector_type"]);
+    options->set_mutable_globals(values["mutable_globals"]);
+    options->set_userdata_types(values["userdata_types"]);
+    options->set_library_constants(values["library_constants"]);
+    options->set_library_member_types(values["library_member_types"]);
+    return options;
+}
+
+static String join_names(const char *const *p_names)
+{
+    String result;
+    for (; p_names && *p_names; p_names++)
+    {
+        result += String::utf8(*p_names) + ",";
+    }
+
+    return result;
+}
+
+String LuaCompileOptions::fingerprint(const LuaCompileOptions *p_options)
+{
+    lua_CompileOptions options = p_options ? p_options->options : default_options();
+
+    String result = vformat("O%d D%d T%d C%d vl=%s vc=%s vt=%s mg=%s ud=%s",
+                            options.optimizationLevel, options.debugLevel, options.typeInfoLevel, options.coverageLevel,
+                            options.vectorLib ? options.vectorLib : "",
+                            options.vectorCtor ? options.vectorCtor : "",
+                            options.vectorType ? options.vectorType : "",
+                            join_names(options.mutableGlobals),
+                            join_names(options.userdataTypes));
+
+    if (p_options)
+    {
+        // Sorted, so that the same members added in a different order describe the same bytecode
+        PackedStringArray members;
+        for (const KeyValue<String, LibraryMember> &E : p_options->library_members)
+        {
+            String member = vformat("%s:%d", E.key, E.value.type);
+            if (E.value.is_constant)
+            {
+                // var_to_str distinguishes 1 from "1", which fold to different bytecode
+                member += "=" + UtilityFunctions::var_to_str(E.value.constant);
+            }
+
+            members.push_back(member);
+        }
+
+        members.sort();
+        for (const String &member : members)
+        {
+            result += " " + member;
+        }
+    }
+
+    return result;
+}
@@ -2,6 +2,11 @@
 
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/variant.hpp>
 #include <luacode.h>
 
 namespace gdluau
@@ -12,8 +17,62 @@ namespace gdluau
     {
         GDCLASS(LuaCompileOptions, RefCounted)
 
+    public:
+        // Makes the library members of p_options visible to the compiler callbacks on this thread,
+        // for the duration of a compile. The callbacks take no userdata, so this is how they find it.
+        class CompileScope
+        {
+            const LuaCompileOptions *previous;
+
+        public:
+            explicit CompileScope(const LuaCompileOptions *p_options);
+            ~CompileScope();
+        };
+
     private:
+        // A null-terminated array of C strings, in the form lua_CompileOptions expects
+        struct CStringList
+        {
+            LocalVector<CharString> strings;
+            LocalVector<const char *> pointers;
+
+            void set(const PackedStringArray &p_strings);
+            const char *const *get() const { return strings.is_empty() ? nullptr : pointers.ptr(); }
+        };
+
+        struct LibraryMember
+        {
+            int type; // LuauBytecodeType
+            bool is_constant = false;
+            Variant constant;
+            CharString string_constant; // Must outlive the compile that folds it
+        };
+
         lua_CompileOptions options;
+        bool native_codegen = false;
+
+        String vector_lib;
+        String vector_ctor;
+        String vector_type;
+        CharString vector_lib_utf8;
+        CharString vector_ctor_utf8;
+        CharString vector_type_utf8;
+
+        PackedStringArray mutable_globals;
+        PackedStringArray userdata_types;
+        CStringList mutable_globals_list;
+        CStringList userdata_types_list;
+
+        Dictionary library_constants;
+        Dictionary library_member_types;
+        CStringList known_libraries_list;
+        HashMap<String, LibraryMember> library_members; // Keyed by "library.member"
+
+        void update_library_members();
+        const LibraryMember *find_library_member(const char *p_library, const char *p_member) const;
+
+        static int library_member_type_cb(const char *p_library, const char *p_member);
+        static void library_member_constant_cb(const char *p_library, const char *p_member, lua_CompileConstant *p_constant);
 
     protected:
         static void _bind_methods();
@@ -33,6 +92,30 @@ namespace gdluau
         void set_coverage_level(int p_level);
         int get_coverage_level() const;
 
+        void set_native_codegen(bool p_enabled);
+        bool get_native_codegen() const;
+
+        void set_vector_lib(const String &p_name);
+        String get_vector_lib() const;
+
+        void set_vector_ctor(const String &p_name);
+        String get_vector_ctor() const;
+
+        void set_vector_type(const String &p_name);
+        String get_vector_type() const;
+
+        void set_mutable_globals(const PackedStringArray &p_names);
+        PackedStringArray get_mutable_globals() const;
+
+        void set_userdata_types(const PackedStringArray &p_names);
+        PackedStringArray get_userdata_types() const;
+
+        void set_library_constants(const Dictionary &p_constants);
+        Dictionary get_library_constants() const;
+
+        void set_library_member_types(const Dictionary &p_types);
+        Dictionary get_library_member_types() const;
+
         static lua_CompileOptions default_options()
         {
             lua_CompileOptions options = {0};
@@ -48,6 +131,16 @@ namespace gdluau
             return options;
         }
 
+        // Points into storage owned by this object. The library member callbacks only answer
+        // inside a CompileScope, which Luau::compile sets up.
         const lua_CompileOptions &get_options() const { return options; }
+
+        // Every option by property name, for storing options alongside precompiled bytecode
+        Dictionary to_dictionary() const;
+        static Ref<LuaCompileOptions> from_dictionary(const Dictionary &p_options);
+
+        // Describes every option that affects the compiled bytecode, for use in cache keys.
+        // Null describes default_options().
+        static String fingerprint(const LuaCompileOptions *p_options);
     };
 } // namespace gdluau
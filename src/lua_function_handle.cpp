@@ -0,0 +1,122 @@
+#include "lua_function_handle.h"
+
+#include "bridging/variant.h"
+#include "lua_state.h"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+
+using namespace gdluau;
+using namespace godot;
+
+void LuaFunctionHandle::_bind_methods()
+{
+    ClassDB::bind_method(D_METHOD("is_valid"), &LuaFunctionHandle::is_valid);
+    ClassDB::bind_method(D_METHOD("get_state"), &LuaFunctionHandle::get_state);
+
+    ClassDB::bind_vararg_method(METHOD_FLAGS_DEFAULT, "invoke", &LuaFunctionHandle::invoke, MethodInfo("invoke"));
+    ClassDB::bind_vararg_method(METHOD_FLAGS_DEFAULT, "invoke_multi", &LuaFunctionHandle::invoke_multi, MethodInfo(Variant::ARRAY, "invoke_multi"));
+}
+
+LuaFunctionHandle::LuaFunctionHandle(LuaState *p_state, int p_lua_ref)
+    : state(p_state), state_token(p_state->get_token()), lua_ref(p_lua_ref)
+{
+    state_token->reference();
+}
+
+LuaFunctionHandle::~LuaFunctionHandle()
+{
+    if (is_valid())
+    {
+        state->unref(lua_ref);
+    }
+
+    if (state_token)
+    {
+        state_token->unreference();
+    }
+}
+
+LuaState *LuaFunctionHandle::get_live_state() const
+{
+    return state_token && !state_token->is_closed() ? state : nullptr;
+}
+
+bool LuaFunctionHandle::is_valid() const
+{
+    LuaState *live_state = get_live_state();
+    return lua_ref != LUA_NOREF && live_state && live_state->is_valid();
+}
+
+Ref<LuaState> LuaFunctionHandle::get_state() const
+{
+    return Ref<LuaState>(get_live_state());
+}
+
+// Pushes the pinned function and the arguments straight from the call, then calls it in protected mode.
+// Returns the number of results left on the stack, or -1 on error (with nothing left on the stack).
+static int call_pinned_function(lua_State *L, int p_lua_ref, const Variant **p_args, int p_arg_count, int p_nresults)
+{
+    ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 1 + p_arg_count), -1, vformat("LuaFunctionHandle.invoke(): Stack overflow. Cannot grow stack for %d arguments.", p_arg_count));
+
+    int top = lua_gettop(L);
+
+    // Values with a __call metamethod are called by lua_pcall() itself
+    lua_getref(L, p_lua_ref);
+    for (int i = 0; i < p_arg_count; i++)
+    {
+        push_variant(L, *p_args[i]);
+    }
+
+    int status = lua_pcall(L, p_arg_count, p_nresults, 0);
+    if (status != LUA_OK) [[unlikely]]
+    {
+        String error_msg = String::utf8(lua_tostring(L, -1));
+        lua_settop(L, top);
+        ERR_FAIL_V_MSG(-1, vformat("LuaFunctionHandle.invoke(): %s", error_msg));
+    }
+
+    return lua_gettop(L) - top;
+}
+
+Variant LuaFunctionHandle::invoke(const Variant **p_args, GDExtensionInt p_arg_count, GDExtensionCallError &r_error)
+{
+    r_error.error = GDEXTENSION_CALL_OK;
+
+    if (!is_valid()) [[unlikely]]
+    {
+        r_error.error = GDEXTENSION_CALL_ERROR_INSTANCE_IS_NULL;
+        ERR_FAIL_V_MSG(Variant(), "LuaFunctionHandle.invoke(): The function's LuaState is no longer valid.");
+    }
+
+    lua_State *L = state->get_lua_state();
+    if (call_pinned_function(L, lua_ref, p_args, static_cast<int>(p_arg_count), 1) < 0) [[unlikely]]
+    {
+        // Don't set r_error, to avoid a fatal script error
+        return Variant();
+    }
+
+    Variant result = to_variant(L, -1);
+    lua_pop(L, 1);
+    return result;
+}
+
+Array LuaFunctionHandle::invoke_multi(const Variant **p_args, GDExtensionInt p_arg_count, GDExtensionCallError &r_error)
+{
+    r_error.error = GDEXTENSION_CALL_OK;
+
+    if (!is_valid()) [[unlikely]]
+    {
+        r_error.error = GDEXTENSION_CALL_ERROR_INSTANCE_IS_NULL;
+        ERR_FAIL_V_MSG(Array(), "LuaFunctionHandle.invoke_multi(): The function's LuaState is no longer valid.");
+    }
+
+    lua_State *L = state->get_lua_state();
+    int nresults = call_pinned_function(L, lua_ref, p_args, static_cast<int>(p_arg_count), LUA_MULTRET);
+    if (nresults < 0) [[unlikely]]
+    {
+        return Array();
+    }
+
+    return state->pop_values(nresults);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <lua.h>
+
+namespace gdluau
+{
+    using namespace godot;
+
+    class LuaState;
+    class LuaStateToken;
+
+    // A Lua function (or value with a __call metamethod) pinned in the registry, so that it can be
+    // called repeatedly without looking it up by name. Created with LuaState.prepare_call().
+    class LuaFunctionHandle : public RefCounted
+    {
+        GDCLASS(LuaFunctionHandle, RefCounted);
+
+    private:
+        // Held weakly, so that a handle stored inside its own state doesn't keep the state alive
+        LuaState *state = nullptr;
+        LuaStateToken *state_token = nullptr; // Shared with the LuaState, to check whether it is still alive
+        int lua_ref = LUA_NOREF;
+
+        LuaState *get_live_state() const;
+
+    protected:
+        static void _bind_methods();
+
+    public:
+        LuaFunctionHandle() {}
+        LuaFunctionHandle(LuaState *p_state, int p_lua_ref);
+        ~LuaFunctionHandle();
+
+        bool is_valid() const;
+        Ref<LuaState> get_state() const;
+
+        Variant invoke(const Variant **p_args, GDExtensionInt p_arg_count, GDExtensionCallError &r_error);
+        Array invoke_multi(const Variant **p_args, GDExtensionInt p_arg_count, GDExtensionCallError &r_error);
+    };
+} // namespace gdluau
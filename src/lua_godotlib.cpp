@@ -2,6 +2,7 @@
 
 #include "bridging/array.h"
 #include "bridging/object.h"
+#include "bridging/packed_array.h"
 #include "bridging/variant.h"
 #include "helpers.h"
 
@@ -463,169 +464,94 @@ static int signal_constructor(lua_State *L)
 
 static int packed_byte_array_constructor(lua_State *L)
 {
-    if (lua_gettop(L) == 1)
+    // PackedByteArrays are represented as buffers, so tables are written straight into one
+    if (lua_istable(L, 1))
     {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
+        int len = lua_objlen(L, 1);
+        uint8_t *buf = static_cast<uint8_t *>(lua_newbuffer(L, len));
+        for (int i = 0; i < len; i++)
+        {
+            lua_rawgeti(L, 1, i + 1);
+            buf[i] = static_cast<uint8_t>(static_cast<int64_t>(lua_tonumber(L, -1)));
+            lua_pop(L, 1);
+        }
 
-        push_variant(L, PackedByteArray(array));
-    }
-    else
-    {
-        lua_newbuffer(L, 0);
+        return 1;
     }
 
-    return 1;
-}
-
-static int packed_int32_array_constructor(lua_State *L)
-{
-    if (lua_gettop(L) == 1)
-    {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedInt32Array(array));
-    }
-    else
+    bool converted;
     {
-        push_variant(L, PackedInt32Array());
-    }
-
-    return 1;
-}
-
-static int packed_int64_array_constructor(lua_State *L)
-{
-    if (lua_gettop(L) == 1)
-    {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedInt64Array(array));
-    }
-    else
-    {
-        push_variant(L, PackedInt64Array());
+        PackedByteArray array;
+        converted = lua_gettop(L) == 0 || to_packed_array(L, 1, array);
+        if (converted)
+        {
+            lua_settop(L, 0);
+            push_packed_array_buffer(L, array);
+        }
     }
 
-    return 1;
-}
-
-static int packed_float32_array_constructor(lua_State *L)
-{
-    if (lua_gettop(L) == 1)
-    {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedFloat32Array(array));
-    }
-    else
+    if (!converted) [[unlikely]]
     {
-        push_variant(L, PackedFloat32Array());
+        luaL_typeerror(L, 1, "table, buffer or packed array");
     }
 
     return 1;
 }
 
-static int packed_float64_array_constructor(lua_State *L)
+// Builds the packed array directly from a table, buffer or other packed array
+template <typename TPacked>
+static int packed_array_constructor(lua_State *L)
 {
-    if (lua_gettop(L) == 1)
+    bool converted;
     {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedFloat64Array(array));
-    }
-    else
-    {
-        push_variant(L, PackedFloat64Array());
+        TPacked array;
+        converted = lua_gettop(L) == 0 || to_packed_array(L, 1, array);
+        if (converted)
+        {
+            lua_settop(L, 0);
+            push_variant(L, array);
+        }
     }
 
-    return 1;
-}
-
-static int packed_string_array_constructor(lua_State *L)
-{
-    if (lua_gettop(L) == 1)
+    if (!converted) [[unlikely]]
     {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedStringArray(array));
-    }
-    else
-    {
-        push_variant(L, PackedStringArray());
+        luaL_typeerror(L, 1, "table, buffer or packed array");
     }
 
     return 1;
 }
 
-static int packed_vector2_array_constructor(lua_State *L)
+// godot.tobuffer(packed): copies the raw element data of a packed array into a buffer
+static int godotlib_tobuffer(lua_State *L)
 {
-    if (lua_gettop(L) == 1)
+    bool pushed = false;
+    if (lua_type(L, 1) == LUA_TUSERDATA)
     {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedVector2Array(array));
+        Variant value = to_variant(L, 1);
+        pushed = push_packed_variant_buffer(L, value);
     }
-    else
-    {
-        push_variant(L, PackedVector2Array());
-    }
-
-    return 1;
-}
-
-static int packed_vector3_array_constructor(lua_State *L)
-{
-    if (lua_gettop(L) == 1)
-    {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
 
-        push_variant(L, PackedVector3Array(array));
-    }
-    else
+    if (!pushed) [[unlikely]]
     {
-        push_variant(L, PackedVector3Array());
+        luaL_typeerror(L, 1, "packed array");
     }
 
     return 1;
 }
 
-static int packed_color_array_constructor(lua_State *L)
+// godot.totable(packed): copies the elements of a packed array (or the bytes of a buffer) into a table
+static int godotlib_totable(lua_State *L)
 {
-    if (lua_gettop(L) == 1)
-    {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedColorArray(array));
-    }
-    else
+    bool pushed = false;
+    if (lua_type(L, 1) == LUA_TUSERDATA || lua_type(L, 1) == LUA_TBUFFER)
     {
-        push_variant(L, PackedColorArray());
+        Variant value = to_variant(L, 1);
+        pushed = push_packed_variant_table(L, value);
     }
 
-    return 1;
-}
-
-static int packed_vector4_array_constructor(lua_State *L)
-{
-    if (lua_gettop(L) == 1)
+    if (!pushed) [[unlikely]]
     {
-        Array array = to_array(L, 1);
-        lua_pop(L, 1);
-
-        push_variant(L, PackedVector4Array(array));
-    }
-    else
-    {
-        push_variant(L, PackedVector4Array());
+        luaL_typeerror(L, 1, "packed array");
     }
 
     return 1;
@@ -688,15 +614,15 @@ int luaopen_godot(lua_State *L)
         {"RID", rid_constructor},
         {"Signal", signal_constructor},
         {"PackedByteArray", packed_byte_array_constructor},
-        {"PackedInt32Array", packed_int32_array_constructor},
-        {"PackedInt64Array", packed_int64_array_constructor},
-        {"PackedFloat32Array", packed_float32_array_constructor},
-        {"PackedFloat64Array", packed_float64_array_constructor},
-        {"PackedStringArray", packed_string_array_constructor},
-        {"PackedVector2Array", packed_vector2_array_constructor},
-        {"PackedVector3Array", packed_vector3_array_constructor},
-        {"PackedColorArray", packed_color_array_constructor},
-        {"PackedVector4Array", packed_vector4_array_constructor},
+        {"PackedInt32Array", packed_array_constructor<PackedInt32Array>},
+        {"PackedInt64Array", packed_array_constructor<PackedInt64Array>},
+        {"PackedFloat32Array", packed_array_constructor<PackedFloat32Array>},
+        {"PackedFloat64Array", packed_array_constructor<PackedFloat64Array>},
+        {"PackedStringArray", packed_array_constructor<PackedStringArray>},
+        {"PackedVector2Array", packed_array_constructor<PackedVector2Array>},
+        {"PackedVector3Array", packed_array_constructor<PackedVector3Array>},
+        {"PackedColorArray", packed_array_constructor<PackedColorArray>},
+        {"PackedVector4Array", packed_array_constructor<PackedVector4Array>},
 
         // Override Luau default `print` so that it shows up in Godot debugging
         {"print", godotlib_print},
@@ -708,8 +634,10 @@ int luaopen_godot(lua_State *L)
     luaL_register(L, NULL, globals);
     lua_pop(L, 1);
 
-    // Even if we have no namespaced functions (for now), create the `godot` table and package.loaded entry
     luaL_Reg namespaced[] = {
+        {"tobuffer", godotlib_tobuffer},
+        {"totable", godotlib_totable},
+
         {NULL, NULL} // sentinel
     };
     luaL_register(L, "godot", namespaced);
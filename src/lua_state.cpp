@@ -1,12 +1,15 @@
 #include "lua_state.h"
 
 #include "bridging/array.h"
+#include "bridging/buffer_view.h"
 #include "bridging/callable.h"
+#include "bridging/container_proxy.h"
 #include "bridging/dictionary.h"
 #include "bridging/object.h"
 #include "bridging/variant.h"
 #include "helpers.h"
 #include "lua_debug.h"
+#include "lua_function_handle.h"
 #include "lua_godotlib.h"
 #include "luau.h"
 #include "static_strings.h"
@@ -16,6 +19,7 @@
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/templates/local_vector.hpp>
+#include <luacodegen.h>
 #include <lualib.h>
 
 using namespace gdluau;
@@ -122,6 +126,24 @@ static void coverage_wrapper(void *context, const char *function, int linedefine
     callable->call(function_str, linedefined, depth, hits_array);
 }
 
+// Converts the top p_count stack values (bottom to top) into an Array, and pops them
+static Array pop_values_to_array(lua_State *L, int p_count)
+{
+    Array values;
+    values.resize(p_count);
+
+    // Values share one conversion, so a table returned more than once becomes the same container
+    ConversionContext context;
+    int first = lua_gettop(L) - p_count + 1;
+    for (int i = 0; i < p_count; i++)
+    {
+        values[i] = to_variant(L, first + i, context);
+    }
+
+    lua_pop(L, p_count);
+    return values;
+}
+
 static int callable_metamethod_wrapper(lua_State *L)
 {
     luaL_checkstack(L, 1, "LuaState.callable_metamethod_wrapper: Stack overflow. Cannot grow stack.");
@@ -246,10 +268,15 @@ void LuaState::_bind_methods()
     ClassDB::bind_method(D_METHOD("set_fenv", "index"), &LuaState::set_fenv);
 
     // Load and call functions (Luau bytecode)
-    ClassDB::bind_method(D_METHOD("load_bytecode", "bytecode", "chunk_name", "env"), &LuaState::load_bytecode, DEFVAL(0));
+    ClassDB::bind_method(D_METHOD("load_bytecode", "bytecode", "chunk_name", "env", "options"), &LuaState::load_bytecode, DEFVAL(0), DEFVAL(Ref<LuaCompileOptions>()));
     ClassDB::bind_method(D_METHOD("pcall", "nargs", "nresults", "errfunc"), &LuaState::pcall, DEFVAL(0));
     ClassDB::bind_method(D_METHOD("cpcall", "callable"), &LuaState::cpcall);
 
+    // Native code generation
+    ClassDB::bind_method(D_METHOD("enable_codegen"), &LuaState::enable_codegen);
+    ClassDB::bind_method(D_METHOD("is_codegen_enabled"), &LuaState::is_codegen_enabled);
+    ClassDB::bind_method(D_METHOD("compile_native", "index"), &LuaState::compile_native);
+
     // Coroutine functions
     ClassDB::bind_method(D_METHOD("yield", "nresults"), &LuaState::yield);
     ClassDB::bind_method(D_METHOD("break"), &LuaState::lua_break);
@@ -338,20 +365,29 @@ void LuaState::_bind_methods()
 
     // Godot bridging
     ClassDB::bind_method(D_METHOD("is_array", "index"), &LuaState::is_array);
+    ClassDB::bind_method(D_METHOD("is_buffer_view", "index"), &LuaState::is_buffer_view);
     ClassDB::bind_method(D_METHOD("is_object", "index", "tag"), &LuaState::is_object, DEFVAL(LUA_NOTAG));
     ClassDB::bind_method(D_METHOD("to_array", "index"), &LuaState::to_array);
-    ClassDB::bind_method(D_METHOD("to_callable", "index"), &LuaState::to_callable);
+    ClassDB::bind_method(D_METHOD("to_array_typed", "index", "type", "class_name"), &LuaState::to_array_typed, DEFVAL(StringName()));
+    ClassDB::bind_method(D_METHOD("to_callable", "index", "multiple_returns"), &LuaState::to_callable, DEFVAL(false));
     ClassDB::bind_method(D_METHOD("to_dictionary", "index"), &LuaState::to_dictionary);
+    ClassDB::bind_method(D_METHOD("to_dictionary_typed", "index", "key_type", "value_type"), &LuaState::to_dictionary_typed);
     ClassDB::bind_method(D_METHOD("to_variant", "index"), &LuaState::to_variant);
     ClassDB::bind_method(D_METHOD("push_array", "value"), &LuaState::push_array);
+    ClassDB::bind_method(D_METHOD("push_buffer_view", "bytes"), &LuaState::push_buffer_view);
     ClassDB::bind_method(D_METHOD("push_callable", "value"), &LuaState::push_callable);
     ClassDB::bind_method(D_METHOD("push_dictionary", "value"), &LuaState::push_dictionary);
     ClassDB::bind_method(D_METHOD("push_variant", "value"), &LuaState::push_variant);
+    ClassDB::bind_method(D_METHOD("push_variant_proxy", "value"), &LuaState::push_variant_proxy);
     ClassDB::bind_method(D_METHOD("push_default_object_metatable"), &LuaState::push_default_object_metatable);
 
     // Additional convenience functions
     ClassDB::bind_method(D_METHOD("load_string", "code", "chunk_name", "env"), &LuaState::load_string, DEFVAL(0));
     ClassDB::bind_method(D_METHOD("do_string", "code", "chunk_name", "env", "nargs", "nresults", "errfunc"), &LuaState::do_string, DEFVAL(String()), DEFVAL(0), DEFVAL(0), DEFVAL(LUA_MULTRET), DEFVAL(0));
+    ClassDB::bind_method(D_METHOD("push_values", "values"), &LuaState::push_values);
+    ClassDB::bind_method(D_METHOD("pop_values", "count"), &LuaState::pop_values);
+    ClassDB::bind_method(D_METHOD("call_function", "name", "args"), &LuaState::call_function, DEFVAL(Array()));
+    ClassDB::bind_method(D_METHOD("prepare_call", "function"), &LuaState::prepare_call);
     ClassDB::bind_static_method(LuaState::get_class_static(), D_METHOD("bind_callable", "callable"), &LuaState::bind_callable);
     ClassDB::bind_method(D_METHOD("set_call_metamethod", "metatable_index", "callable"), &LuaState::set_call_metamethod);
     ClassDB::bind_method(D_METHOD("set_index_metamethod", "metatable_index", "callable"), &LuaState::set_index_metamethod);
@@ -381,7 +417,7 @@ LuaState::LuaState() : LuaState(luaL_newstate())
 }
 
 LuaState::LuaState(lua_State *p_L)
-    : L(p_L)
+    : L(p_L), token(memnew(LuaStateToken))
 {
     ERR_FAIL_NULL_MSG(L, "lua_State* is null.");
 
@@ -393,7 +429,7 @@ LuaState::LuaState(lua_State *p_L)
 
 // Private constructor for thread states
 LuaState::LuaState(lua_State *p_thread_L, const Ref<LuaState> &p_main_thread)
-    : L(p_thread_L), main_thread(p_main_thread)
+    : L(p_thread_L), main_thread(p_main_thread), token(memnew(LuaStateToken))
 {
     ERR_FAIL_NULL_MSG(p_thread_L, "Thread lua_State* is null.");
     ERR_FAIL_COND_MSG(!p_main_thread.is_valid(), "Main LuaState is not valid.");
@@ -405,6 +441,7 @@ LuaState::LuaState(lua_State *p_thread_L, const Ref<LuaState> &p_main_thread)
 LuaState::~LuaState()
 {
     close();
+    token->unreference();
 }
 
 void LuaState::setup_vm()
@@ -435,6 +472,8 @@ bool LuaState::is_valid_index(int p_index)
 // State manipulation
 void LuaState::close()
 {
+    token->mark_closed();
+
     if (!is_valid())
     {
         return;
@@ -893,6 +932,12 @@ PackedByteArray LuaState::to_buffer(int p_index)
     ERR_FAIL_COND_V_MSG(!is_valid(), PackedByteArray(), "Lua state is invalid. Cannot convert to buffer.");
     ERR_FAIL_COND_V_MSG(!is_valid_index(p_index), PackedByteArray(), vformat("LuaState.to_buffer(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
 
+    if (PackedByteArray *view = gdluau::to_buffer_view(L, p_index)) [[unlikely]]
+    {
+        // Views already wrap a PackedByteArray, so share it instead of copying
+        return *view;
+    }
+
     size_t size;
     void *data = lua_tobuffer(L, p_index, &size);
     if (!data)
@@ -1220,12 +1265,23 @@ bool LuaState::set_fenv(int p_index)
 }
 
 // Load and call functions (Luau bytecode)
-bool LuaState::load_bytecode(const PackedByteArray &p_bytecode, const String &p_chunk_name, int p_env)
+bool LuaState::load_bytecode(const PackedByteArray &p_bytecode, const String &p_chunk_name, int p_env, const Ref<LuaCompileOptions> &p_options)
 {
     ERR_FAIL_COND_V_MSG(!is_valid(), false, "Lua state is invalid. Cannot load bytecode.");
     ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 1), false, "LuaState.load_bytecode(): Stack overflow. Cannot grow stack.");
 
-    return luau_load(L, p_chunk_name.utf8().get_data(), reinterpret_cast<const char *>(p_bytecode.ptr()), p_bytecode.size(), p_env) == 0;
+    if (luau_load(L, p_chunk_name.utf8().get_data(), reinterpret_cast<const char *>(p_bytecode.ptr()), p_bytecode.size(), p_env) != 0)
+    {
+        return false;
+    }
+
+    // Native compilation is best-effort: if the platform doesn't support it, the chunk stays interpreted.
+    if (p_options.is_valid() && p_options->get_native_codegen() && enable_codegen())
+    {
+        luau_codegen_compile(L, -1);
+    }
+
+    return true;
 }
 
 lua_Status LuaState::pcall(int p_nargs, int p_nresults, int p_errfunc)
@@ -1251,6 +1307,53 @@ lua_Status LuaState::cpcall(Callable p_callable)
     return static_cast<lua_Status>(status);
 }
 
+// Native code generation
+bool LuaState::enable_codegen()
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), false, "Lua state is invalid. Cannot enable native code generation.");
+
+    if (!is_main_thread())
+    {
+        // Code generation is a property of the whole VM, so track it on the main thread
+        return main_thread->enable_codegen();
+    }
+
+    if (codegen_enabled)
+    {
+        return true;
+    }
+
+    if (!luau_codegen_supported())
+    {
+        return false;
+    }
+
+    luau_codegen_create(L);
+    codegen_enabled = true;
+    return true;
+}
+
+bool LuaState::is_codegen_enabled() const
+{
+    if (!is_valid())
+    {
+        return false;
+    }
+
+    return is_main_thread() ? codegen_enabled : main_thread->codegen_enabled;
+}
+
+bool LuaState::compile_native(int p_index)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), false, "Lua state is invalid. Cannot compile function to native code.");
+    ERR_FAIL_COND_V_MSG(!is_valid_index(p_index), false, vformat("LuaState.compile_native(%d): Invalid stack index. Stack has %d elements.", p_index, lua_gettop(L)));
+    ERR_FAIL_COND_V_MSG(!lua_isLfunction(L, p_index), false, vformat("LuaState.compile_native(%d): Value is not a Lua function.", p_index));
+    ERR_FAIL_COND_V_MSG(!is_codegen_enabled(), false, vformat("LuaState.compile_native(%d): Native code generation is not enabled. Call enable_codegen() first.", p_index));
+
+    luau_codegen_compile(L, p_index);
+    return true;
+}
+
 // Coroutine functions
 void LuaState::yield(int p_nresults)
 {
@@ -1959,6 +2062,12 @@ bool LuaState::is_array(int p_index)
     return gdluau::is_array(L, p_index);
 }
 
+bool LuaState::is_buffer_view(int p_index)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), false, "Lua state is invalid. Cannot check if value is buffer view.");
+    return gdluau::is_buffer_view(L, p_index);
+}
+
 bool LuaState::is_object(int p_index, int p_tag)
 {
     ERR_FAIL_COND_V_MSG(!is_valid(), false, "Lua state is invalid. Cannot check if value is array.");
@@ -1971,10 +2080,16 @@ Array LuaState::to_array(int p_index)
     return gdluau::to_array(L, p_index);
 }
 
-Callable LuaState::to_callable(int p_index)
+Array LuaState::to_array_typed(int p_index, Variant::Type p_type, const StringName &p_class_name)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), Array(), "Lua state is invalid. Cannot convert to typed Array.");
+    return gdluau::to_array_typed(L, p_index, p_type, p_class_name);
+}
+
+Callable LuaState::to_callable(int p_index, bool p_multiple_returns)
 {
     ERR_FAIL_COND_V_MSG(!is_valid(), Callable(), "Lua state is invalid. Cannot convert to Callable.");
-    return gdluau::to_callable(L, p_index);
+    return gdluau::to_callable(L, p_index, p_multiple_returns);
 }
 
 Dictionary LuaState::to_dictionary(int p_index)
@@ -1983,6 +2098,12 @@ Dictionary LuaState::to_dictionary(int p_index)
     return gdluau::to_dictionary(L, p_index);
 }
 
+Dictionary LuaState::to_dictionary_typed(int p_index, Variant::Type p_key_type, Variant::Type p_value_type)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), Dictionary(), "Lua state is invalid. Cannot convert to typed Dictionary.");
+    return gdluau::to_dictionary_typed(L, p_index, p_key_type, p_value_type);
+}
+
 Variant LuaState::to_variant(int p_index)
 {
     ERR_FAIL_COND_V_MSG(!is_valid(), Variant(), "Lua state is invalid. Cannot convert to Variant.");
@@ -1995,6 +2116,12 @@ void LuaState::push_array(const Array &p_arr)
     gdluau::push_array(L, p_arr);
 }
 
+void LuaState::push_buffer_view(const PackedByteArray &p_bytes)
+{
+    ERR_FAIL_COND_MSG(!is_valid(), "Lua state is invalid. Cannot push buffer view.");
+    gdluau::push_buffer_view(L, p_bytes);
+}
+
 void LuaState::push_callable(const Callable &p_callable)
 {
     ERR_FAIL_COND_MSG(!is_valid(), "Lua state is invalid. Cannot push Callable.");
@@ -2013,6 +2140,12 @@ void LuaState::push_variant(const Variant &p_value)
     gdluau::push_variant(L, p_value);
 }
 
+void LuaState::push_variant_proxy(const Variant &p_value)
+{
+    ERR_FAIL_COND_MSG(!is_valid(), "Lua state is invalid. Cannot push Variant.");
+    gdluau::push_variant_proxy(L, p_value);
+}
+
 void LuaState::push_default_object_metatable()
 {
     ERR_FAIL_COND_MSG(!is_valid(), "Lua state is invalid. Cannot push object metatable.");
@@ -2041,6 +2174,103 @@ lua_Status LuaState::do_string(const String &p_code, const String &p_chunk_name,
     }
 }
 
+void LuaState::push_values(const Array &p_values)
+{
+    ERR_FAIL_COND_MSG(!is_valid(), "Lua state is invalid. Cannot push values.");
+
+    int count = static_cast<int>(p_values.size());
+    ERR_FAIL_COND_MSG(!lua_checkstack(L, count), vformat("LuaState.push_values(): Stack overflow. Cannot grow stack by %d elements.", count));
+
+    for (int i = 0; i < count; i++)
+    {
+        gdluau::push_variant(L, p_values[i]);
+    }
+}
+
+Array LuaState::pop_values(int p_count)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), Array(), "Lua state is invalid. Cannot pop values.");
+
+    int top = lua_gettop(L);
+    ERR_FAIL_COND_V_MSG(p_count < 0, Array(), vformat("LuaState.pop_values(%d): Cannot pop negative number of elements.", p_count));
+    ERR_FAIL_COND_V_MSG(top < p_count, Array(), vformat("LuaState.pop_values(%d): Stack underflow. Stack only has %d elements.", p_count, top));
+
+    return pop_values_to_array(L, p_count);
+}
+
+Array LuaState::call_function(const StringName &p_name, const Array &p_args)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), Array(), "Lua state is invalid. Cannot call function.");
+
+    int nargs = static_cast<int>(p_args.size());
+    ERR_FAIL_COND_V_MSG(!lua_checkstack(L, nargs + 1), Array(), vformat("LuaState.call_function(\"%s\"): Stack overflow. Cannot grow stack by %d elements.", p_name, nargs + 1));
+
+    int top = lua_gettop(L);
+
+    // Calling a missing global fails in the pcall below, with Lua's own error message
+    lua_getglobal(L, char_string(p_name).get_data());
+
+    for (int i = 0; i < nargs; i++)
+    {
+        gdluau::push_variant(L, p_args[i]);
+    }
+
+    int status = lua_pcall(L, nargs, LUA_MULTRET, 0);
+    if (status != LUA_OK) [[unlikely]]
+    {
+        String err_msg = String::utf8(lua_tostring(L, -1));
+        lua_settop(L, top);
+        ERR_FAIL_V_MSG(Array(), vformat("LuaState.call_function(\"%s\"): %s", p_name, err_msg));
+    }
+
+    return pop_values_to_array(L, lua_gettop(L) - top);
+}
+
+Ref<LuaFunctionHandle> LuaState::prepare_call(const Variant &p_function)
+{
+    ERR_FAIL_COND_V_MSG(!is_valid(), Ref<LuaFunctionHandle>(), "Lua state is invalid. Cannot prepare call.");
+    ERR_FAIL_COND_V_MSG(!lua_checkstack(L, 1), Ref<LuaFunctionHandle>(), "LuaState.prepare_call(): Stack overflow. Cannot grow stack.");
+
+    switch (p_function.get_type())
+    {
+    case Variant::STRING:
+        [[fallthrough]];
+    case Variant::STRING_NAME:
+    {
+        StringName name = p_function;
+        lua_getglobal(L, char_string(name).get_data());
+        break;
+    }
+
+    case Variant::INT:
+    {
+        int index = p_function;
+        ERR_FAIL_COND_V_MSG(!is_valid_index(index), Ref<LuaFunctionHandle>(), vformat("LuaState.prepare_call(%d): Invalid stack index. Stack has %d elements.", index, lua_gettop(L)));
+        lua_pushvalue(L, index);
+        break;
+    }
+
+    default:
+        ERR_FAIL_V_MSG(Ref<LuaFunctionHandle>(), vformat("LuaState.prepare_call(): Expected a global name or stack index, got %s.", Variant::get_type_name(p_function.get_type())));
+    }
+
+    int type = lua_type(L, -1);
+    if (type != LUA_TFUNCTION)
+    {
+        // Tables and userdata can be called through their __call metamethod
+        bool has_call = (type == LUA_TTABLE || type == LUA_TUSERDATA) && luaL_getmetafield(L, -1, "__call");
+        lua_pop(L, 1); // Pop __call, or the value if it isn't callable
+
+        ERR_FAIL_COND_V_MSG(!has_call, Ref<LuaFunctionHandle>(), vformat("LuaState.prepare_call(%s): Value is not callable (got %s).", p_function, lua_typename(L, type)));
+    }
+
+    // lua_ref doesn't pop the value
+    int function_ref = lua_ref(L, -1);
+    lua_pop(L, 1);
+
+    return memnew(LuaFunctionHandle(this, function_ref));
+}
+
 Callable LuaState::bind_callable(const Callable &p_callable)
 {
     ERR_FAIL_COND_V_MSG(!p_callable.is_valid(), Callable(), "LuaState.bind_callable(): Callable is invalid.");
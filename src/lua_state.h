@@ -4,13 +4,51 @@
 #include <godot_cpp/core/binder_common.hpp>
 #include <lua.h>
 
+#include <atomic>
+
 #include "helpers.h"
+#include "lua_compileoptions.h"
 
 namespace gdluau
 {
     using namespace godot;
 
     class LuaDebug;
+    class LuaFunctionHandle;
+
+    // Closed flag for a LuaState, which stays allocated until its last holder releases it.
+    // Lets holders of a raw LuaState pointer (e.g. LuaCallable) check that it is still alive
+    // without an ObjectDB lookup.
+    class LuaStateToken
+    {
+    private:
+        std::atomic<uint32_t> refcount{1};
+        std::atomic<bool> closed{false};
+
+    public:
+        void reference()
+        {
+            refcount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void unreference()
+        {
+            if (refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                memdelete(this);
+            }
+        }
+
+        bool is_closed() const
+        {
+            return closed.load(std::memory_order_acquire);
+        }
+
+        void mark_closed()
+        {
+            closed.store(true, std::memory_order_release);
+        }
+    };
 
     class LuaState : public RefCounted
     {
@@ -19,6 +57,8 @@ namespace gdluau
     private:
         lua_State *L;
         Ref<LuaState> main_thread; // only set for non-main threads
+        LuaStateToken *token;
+        bool codegen_enabled = false; // only meaningful for the main thread
 
         // Private constructor for main thread
         LuaState(lua_State *p_L);
@@ -185,10 +225,15 @@ namespace gdluau
         bool set_fenv(int p_index);
 
         // Load and call functions (Luau bytecode)
-        bool load_bytecode(const PackedByteArray &p_bytecode, const String &p_chunk_name, int p_env = 0);
+        bool load_bytecode(const PackedByteArray &p_bytecode, const String &p_chunk_name, int p_env = 0, const Ref<LuaCompileOptions> &p_options = Ref<LuaCompileOptions>());
         lua_Status pcall(int p_nargs, int p_nresults, int p_errfunc = 0);
         lua_Status cpcall(Callable p_callable);
 
+        // Native code generation
+        bool enable_codegen();
+        bool is_codegen_enabled() const;
+        bool compile_native(int p_index);
+
         // Coroutine functions
         void yield(int p_nresults);
         void lua_break();
@@ -279,20 +324,29 @@ namespace gdluau
 
         // Godot bridging
         bool is_array(int p_index);
+        bool is_buffer_view(int p_index);
         bool is_object(int p_index, int p_tag = LUA_NOTAG);
         Array to_array(int p_index);
-        Callable to_callable(int p_index);
+        Array to_array_typed(int p_index, Variant::Type p_type, const StringName &p_class_name = StringName());
+        Callable to_callable(int p_index, bool p_multiple_returns = false);
         Dictionary to_dictionary(int p_index);
+        Dictionary to_dictionary_typed(int p_index, Variant::Type p_key_type, Variant::Type p_value_type);
         Variant to_variant(int p_index);
         void push_array(const Array &p_arr);
+        void push_buffer_view(const PackedByteArray &p_bytes);
         void push_callable(const Callable &p_callable);
         void push_dictionary(const Dictionary &p_dict);
         void push_variant(const Variant &p_value);
+        void push_variant_proxy(const Variant &p_value);
         void push_default_object_metatable();
 
         // Additional convenience functions
         bool load_string(const String &p_code, const String &p_chunk_name, int p_env = 0);
         lua_Status do_string(const String &p_code, const String &p_chunk_name = String(), int p_env = 0, int p_nargs = 0, int p_nresults = LUA_MULTRET, int p_errfunc = 0);
+        void push_values(const Array &p_values);
+        Array pop_values(int p_count);
+        Array call_function(const StringName &p_name, const Array &p_args = Array());
+        Ref<LuaFunctionHandle> prepare_call(const Variant &p_function);
         static Callable bind_callable(const Callable &p_callable);
         void set_call_metamethod(int p_metatable_index, const Callable &p_callable);
         void set_index_metamethod(int p_metatable_index, const Callable &p_callable);
@@ -304,6 +358,12 @@ namespace gdluau
             return L;
         }
 
+        // Marked closed by close(). Call reference() to keep it past this LuaState's lifetime.
+        LuaStateToken *get_token() const
+        {
+            return token;
+        }
+
         static LuaState *find_lua_state(lua_State *p_L)
         {
             return static_cast<LuaState *>(lua_getthreaddata(p_L));
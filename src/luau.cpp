@@ -2,10 +2,14 @@
 
 #include "helpers.h"
 #include "lua_compileoptions.h"
+#include "string_cache.h"
 
 #include <godot_cpp/core/class_db.hpp>
+#include <Luau/Compiler.h>
 #include <luacode.h>
 
+#include <string>
+
 using namespace gdluau;
 using namespace godot;
 
@@ -76,25 +80,42 @@ void Luau::_bind_methods()
     BIND_CONSTANT(LUA_VECTOR_SIZE);
 
     ClassDB::bind_static_method(Luau::get_class_static(), D_METHOD("compile", "source_code", "options"), &Luau::compile, DEFVAL(nullptr));
+    ClassDB::bind_static_method(Luau::get_class_static(), D_METHOD("compile_async", "source_code", "options"), &Luau::compile_async, DEFVAL(nullptr));
     ClassDB::bind_static_method(Luau::get_class_static(), D_METHOD("upvalue_index", "upvalue"), &Luau::upvalue_index);
     ClassDB::bind_static_method(Luau::get_class_static(), D_METHOD("is_pseudo", "index"), &Luau::is_pseudo);
     ClassDB::bind_static_method(Luau::get_class_static(), D_METHOD("clock"), &Luau::clock);
+    ClassDB::bind_static_method(Luau::get_class_static(), D_METHOD("get_string_cache_stats"), &Luau::get_string_cache_stats);
 }
 
 PackedByteArray Luau::compile(const String &p_source_code, const LuaCompileOptions *p_options)
 {
-    CharString utf8 = p_source_code.utf8();
     lua_CompileOptions options = p_options ? p_options->get_options() : LuaCompileOptions::default_options();
 
-    size_t bytecode_size;
-    char *bytecode = luau_compile(utf8.get_data(), utf8.length(), &options, &bytecode_size);
+    // luau_compile() copies its result into a malloc'd buffer that we would then have to copy
+    // again and free, so call the C++ compiler directly, as luau_compile() does internally.
+    // Its options struct is layout-compatible with the C one.
+    static_assert(sizeof(lua_CompileOptions) == sizeof(::Luau::CompileOptions), "C and C++ compile options must match");
+    ::Luau::CompileOptions cpp_options;
+    memcpy(static_cast<void *>(&cpp_options), &options, sizeof(cpp_options));
+
+    std::string bytecode;
+    {
+        LuaCompileOptions::CompileScope scope(p_options);
+        CharString utf8 = p_source_code.utf8();
+        bytecode = ::Luau::compile(std::string(utf8.get_data(), utf8.length()), cpp_options);
+    }
 
     PackedByteArray result;
-    result.resize(bytecode_size);
-    memcpy(result.ptrw(), bytecode, bytecode_size);
+    result.resize(bytecode.size());
+    memcpy(result.ptrw(), bytecode.data(), bytecode.size());
     return result;
 }
 
+Ref<LuauCompileTask> Luau::compile_async(const String &p_source_code, const LuaCompileOptions *p_options)
+{
+    return LuauCompileTask::start(p_source_code, p_options);
+}
+
 int Luau::upvalue_index(int p_upvalue)
 {
     return lua_upvalueindex(p_upvalue);
@@ -109,3 +130,16 @@ double Luau::clock()
 {
     return lua_clock();
 }
+
+Dictionary Luau::get_string_cache_stats()
+{
+    StringCacheStats stats = gdluau::get_string_cache_stats();
+
+    Dictionary result;
+    result["capacity"] = static_cast<int64_t>(stats.capacity);
+    result["used"] = static_cast<int64_t>(stats.used);
+    result["hits"] = static_cast<int64_t>(stats.hits);
+    result["misses"] = static_cast<int64_t>(stats.misses);
+    result["collisions"] = static_cast<int64_t>(stats.collisions);
+    return result;
+}
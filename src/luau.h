@@ -1,7 +1,10 @@
 #pragma once
 
+#include "luau_compile_task.h"
+
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
 #include <lua.h>
 
 namespace gdluau
@@ -19,9 +22,11 @@ namespace gdluau
 
     public:
         static PackedByteArray compile(const String &p_source_code, const LuaCompileOptions *p_options = nullptr);
+        static Ref<LuauCompileTask> compile_async(const String &p_source_code, const LuaCompileOptions *p_options = nullptr);
         static int upvalue_index(int p_upvalue);
         static bool is_pseudo(int p_index);
         static double clock();
+        static Dictionary get_string_cache_stats();
     };
 
 } // namespace gdluau
@@ -0,0 +1,62 @@
+#include "luau_compile_task.h"
+
+#include "luau.h"
+
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+
+using namespace gdluau;
+using namespace godot;
+
+void LuauCompileTask::_bind_methods()
+{
+    ClassDB::bind_method(D_METHOD("is_completed"), &LuauCompileTask::is_completed);
+    ClassDB::bind_method(D_METHOD("wait"), &LuauCompileTask::wait);
+}
+
+LuauCompileTask::~LuauCompileTask()
+{
+    // Every WorkerThreadPool task must be waited for, and run() must not outlive this object
+    wait();
+}
+
+Ref<LuauCompileTask> LuauCompileTask::start(const String &p_source_code, const LuaCompileOptions *p_options)
+{
+    Ref<LuauCompileTask> task;
+    task.instantiate();
+    task->source_code = p_source_code;
+
+    // The worker reads the options' string storage and library members, which setters rebuild,
+    // so it compiles with a snapshot rather than the caller's object
+    if (p_options)
+    {
+        task->options = LuaCompileOptions::from_dictionary(p_options->to_dictionary());
+    }
+
+    task->task_id = WorkerThreadPool::get_singleton()->add_task(callable_mp(task.ptr(), &LuauCompileTask::run), false, "Luau.compile_async");
+    return task;
+}
+
+void LuauCompileTask::run()
+{
+    bytecode = Luau::compile(source_code, options.ptr());
+}
+
+bool LuauCompileTask::is_completed() const
+{
+    return waited || WorkerThreadPool::get_singleton()->is_task_completed(task_id);
+}
+
+PackedByteArray LuauCompileTask::wait()
+{
+    if (!waited && task_id >= 0)
+    {
+        Error err = WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+        ERR_FAIL_COND_V_MSG(err != OK, PackedByteArray(), vformat("LuauCompileTask.wait(): Cannot wait for task %d.", task_id));
+        waited = true;
+    }
+
+    return bytecode;
+}
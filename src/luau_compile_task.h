@@ -0,0 +1,39 @@
+#pragma once
+
+#include "lua_compileoptions.h"
+
+#include <godot_cpp/classes/ref_counted.hpp>
+
+namespace gdluau
+{
+    using namespace godot;
+
+    // A Luau compile running on the WorkerThreadPool. Created with Luau.compile_async().
+    class LuauCompileTask : public RefCounted
+    {
+        GDCLASS(LuauCompileTask, RefCounted);
+
+    private:
+        String source_code;
+        Ref<LuaCompileOptions> options;
+        PackedByteArray bytecode;
+
+        int64_t task_id = -1;
+        bool waited = false;
+
+        void run();
+
+    protected:
+        static void _bind_methods();
+
+    public:
+        LuauCompileTask() {}
+        ~LuauCompileTask();
+
+        // p_options is copied, so the caller can keep modifying it while the task runs
+        static Ref<LuauCompileTask> start(const String &p_source_code, const LuaCompileOptions *p_options);
+
+        bool is_completed() const;
+        PackedByteArray wait();
+    };
+} // namespace gdluau
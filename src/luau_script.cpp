@@ -1,5 +1,6 @@
 #include "luau_script.h"
 
+#include "bytecode_cache.h"
 #include "luau.h"
 
 #include <godot_cpp/classes/file_access.hpp>
@@ -18,6 +19,8 @@ void LuauScript::_bind_methods()
 	ClassDB::bind_method(D_METHOD("get_compile_options"), &LuauScript::get_compile_options);
 
 	ClassDB::bind_method(D_METHOD("compile", "force_recompile"), &LuauScript::compile, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("compile_async"), &LuauScript::compile_async);
+	ClassDB::bind_method(D_METHOD("is_precompiled"), &LuauScript::is_precompiled);
 
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "source_code", PROPERTY_HINT_MULTILINE_TEXT), "set_source_code", "get_source_code");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "compile_options", PROPERTY_HINT_RESOURCE_TYPE, "LuaCompileOptions", PROPERTY_USAGE_NONE), "set_compile_options", "get_compile_options");
@@ -28,6 +31,8 @@ void LuauScript::_reset_state()
 	source_code = String();
 	compile_options.unref();
 	cached_bytecode.clear();
+	pending_compile.unref();
+	precompiled = false;
 }
 
 void LuauScript::set_source_code(const String &p_source)
@@ -38,6 +43,8 @@ void LuauScript::set_source_code(const String &p_source)
 	}
 
 	cached_bytecode.clear();
+	pending_compile.unref(); // Waits for it to finish
+	precompiled = false;
 	source_code = p_source;
 }
 
@@ -53,7 +60,17 @@ void LuauScript::set_compile_options(LuaCompileOptions *p_options)
 		return;
 	}
 
+	if (precompiled)
+	{
+		// Options that don't change the bytecode, such as native_codegen, can still be set
+		ERR_FAIL_COND_MSG(LuaCompileOptions::fingerprint(p_options) != LuaCompileOptions::fingerprint(compile_options.ptr()), "Cannot change the compile options of a precompiled LuauScript to ones that produce different bytecode. Set the luau/* export options of the export preset instead.");
+
+		compile_options.reference_ptr(p_options);
+		return;
+	}
+
 	cached_bytecode.clear();
+	pending_compile.unref(); // Waits for it to finish
 	compile_options.reference_ptr(p_options);
 }
 
@@ -62,16 +79,162 @@ LuaCompileOptions *LuauScript::get_compile_options() const
 	return compile_options.ptr();
 }
 
+String LuauScript::get_bytecode_cache_key() const
+{
+	if (!is_bytecode_cache_enabled())
+	{
+		return String();
+	}
+
+	return gdluau::get_bytecode_cache_key(source_code, compile_options.ptr());
+}
+
 const PackedByteArray &LuauScript::compile(bool p_force_recompile)
 {
-	if (cached_bytecode.is_empty() || p_force_recompile)
+	if (precompiled)
+	{
+		// There is no source code to recompile
+		return cached_bytecode;
+	}
+
+	if (!cached_bytecode.is_empty() && !p_force_recompile)
+	{
+		return cached_bytecode;
+	}
+
+	String cache_key = get_bytecode_cache_key();
+	if (pending_compile.is_valid())
 	{
+		// The background compile used the current source and options, so it is as fresh as a recompile
+		cached_bytecode = pending_compile->wait();
+		pending_compile.unref();
+	}
+	else
+	{
+		if (!p_force_recompile && !cache_key.is_empty() && gdluau::load_cached_bytecode(cache_key, cached_bytecode))
+		{
+			return cached_bytecode;
+		}
+
 		cached_bytecode = Luau::compile(source_code, compile_options.ptr());
 	}
 
+	if (!cache_key.is_empty())
+	{
+		store_cached_bytecode(cache_key, cached_bytecode);
+	}
+
 	return cached_bytecode;
 }
 
+void LuauScript::compile_async()
+{
+	if (precompiled || !cached_bytecode.is_empty() || pending_compile.is_valid())
+	{
+		return;
+	}
+
+	if (load_cached_bytecode())
+	{
+		return;
+	}
+
+	pending_compile = Luau::compile_async(source_code, compile_options.ptr());
+}
+
+bool LuauScript::load_cached_bytecode()
+{
+	if (precompiled)
+	{
+		return false;
+	}
+
+	String cache_key = get_bytecode_cache_key();
+	return !cache_key.is_empty() && gdluau::load_cached_bytecode(cache_key, cached_bytecode);
+}
+
+void LuauScript::set_precompiled_bytecode(const PackedByteArray &p_bytecode, const Ref<LuaCompileOptions> &p_options)
+{
+	pending_compile.unref();
+	source_code = String();
+	compile_options = p_options;
+	cached_bytecode = p_bytecode;
+	precompiled = true;
+}
+
+bool LuauScript::is_precompiled() const
+{
+	return precompiled;
+}
+
+// Bump whenever the layout below changes
+static constexpr uint32_t PRECOMPILED_MAGIC = 0x43554C47; // "GLUC"
+static constexpr uint32_t PRECOMPILED_FORMAT_VERSION = 2;
+
+// magic, format version, options size, then the options (LuaCompileOptions::to_dictionary() as
+// var_to_bytes), then the bytecode size and bytecode
+static constexpr int64_t PRECOMPILED_HEADER_SIZE = 4 * 3;
+
+PackedByteArray gdluau::encode_precompiled_script(const PackedByteArray &p_bytecode, const LuaCompileOptions *p_options)
+{
+	Ref<LuaCompileOptions> defaults;
+	if (!p_options)
+	{
+		defaults.instantiate();
+		p_options = defaults.ptr();
+	}
+
+	PackedByteArray options = UtilityFunctions::var_to_bytes(p_options->to_dictionary());
+	int64_t bytecode_offset = PRECOMPILED_HEADER_SIZE + options.size() + 4;
+
+	PackedByteArray data;
+	data.resize(bytecode_offset + p_bytecode.size());
+
+	data.encode_u32(0, PRECOMPILED_MAGIC);
+	data.encode_u32(4, PRECOMPILED_FORMAT_VERSION);
+	data.encode_u32(8, static_cast<uint32_t>(options.size()));
+	memcpy(data.ptrw() + PRECOMPILED_HEADER_SIZE, options.ptr(), options.size());
+	data.encode_u32(bytecode_offset - 4, static_cast<uint32_t>(p_bytecode.size()));
+
+	memcpy(data.ptrw() + bytecode_offset, p_bytecode.ptr(), p_bytecode.size());
+	return data;
+}
+
+Error gdluau::decode_precompiled_script(const PackedByteArray &p_data, PackedByteArray &r_bytecode, Ref<LuaCompileOptions> &r_options)
+{
+	ERR_FAIL_COND_V_MSG(p_data.size() < PRECOMPILED_HEADER_SIZE || p_data.decode_u32(0) != PRECOMPILED_MAGIC, ERR_FILE_UNRECOGNIZED, "Not a precompiled Luau script.");
+	ERR_FAIL_COND_V_MSG(p_data.decode_u32(4) != PRECOMPILED_FORMAT_VERSION, ERR_FILE_UNRECOGNIZED, vformat("Unsupported precompiled Luau script version %d.", p_data.decode_u32(4)));
+
+	int64_t options_size = p_data.decode_u32(8);
+	int64_t bytecode_offset = PRECOMPILED_HEADER_SIZE + options_size + 4;
+	ERR_FAIL_COND_V_MSG(p_data.size() < bytecode_offset, ERR_FILE_CORRUPT, "Precompiled Luau script is truncated.");
+
+	int64_t bytecode_size = p_data.decode_u32(bytecode_offset - 4);
+	ERR_FAIL_COND_V_MSG(p_data.size() - bytecode_offset != bytecode_size, ERR_FILE_CORRUPT, "Precompiled Luau script is truncated.");
+
+	Variant options = UtilityFunctions::bytes_to_var(p_data.slice(PRECOMPILED_HEADER_SIZE, PRECOMPILED_HEADER_SIZE + options_size));
+	ERR_FAIL_COND_V_MSG(options.get_type() != Variant::DICTIONARY, ERR_FILE_CORRUPT, "Precompiled Luau script has invalid compile options.");
+
+	r_options = LuaCompileOptions::from_dictionary(options);
+	r_bytecode = p_data.slice(bytecode_offset);
+	return OK;
+}
+
+static Error load_precompiled_script(const Ref<LuauScript> &p_script, const String &p_path)
+{
+	PackedByteArray data = FileAccess::get_file_as_bytes(p_path);
+	Error err = FileAccess::get_open_error();
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot open precompiled Luau script file '%s'.", p_path));
+
+	PackedByteArray bytecode;
+	Ref<LuaCompileOptions> options;
+	err = decode_precompiled_script(data, bytecode, options);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot load precompiled Luau script file '%s'.", p_path));
+
+	p_script->set_precompiled_bytecode(bytecode, options);
+	return OK;
+}
+
 Variant ResourceFormatLoaderLuauScript::_load(const String &p_path, const String &p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const
 {
 	Ref<LuauScript> script;
@@ -86,16 +249,38 @@ Variant ResourceFormatLoaderLuauScript::_load(const String &p_path, const String
 		script.instantiate();
 	}
 
-	if (p_cache_mode == CACHE_MODE_REPLACE || p_cache_mode == CACHE_MODE_REPLACE_DEEP || script->get_source_code().is_empty())
+	if (p_cache_mode == CACHE_MODE_REPLACE || p_cache_mode == CACHE_MODE_REPLACE_DEEP || (script->get_source_code().is_empty() && !script->is_precompiled()))
 	{
 		// Load from disk
-		Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
-		ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), vformat("Cannot open Luau script file '%s'.", p_path));
-
-		String source = file->get_as_text();
-		file->close();
-
-		script->set_source_code(source);
+		if (p_path.get_extension().to_lower() == "luauc")
+		{
+			Error err = load_precompiled_script(script, p_path);
+			if (err != OK)
+			{
+				return err;
+			}
+		}
+		else
+		{
+			Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+			ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), vformat("Cannot open Luau script file '%s'.", p_path));
+
+			String source = file->get_as_text();
+			file->close();
+
+			script->set_source_code(source);
+
+			if (p_use_sub_threads)
+			{
+				// Compile in the background while the rest of the load continues
+				script->compile_async();
+			}
+			else
+			{
+				// Reuse bytecode compiled by a previous run, so the first compile() doesn't have to
+				script->load_cached_bytecode();
+			}
+		}
 
 		if (p_cache_mode == CACHE_MODE_IGNORE || p_cache_mode == CACHE_MODE_IGNORE_DEEP)
 		{
@@ -117,6 +302,7 @@ PackedStringArray ResourceFormatLoaderLuauScript::_get_recognized_extensions() c
 	PackedStringArray extensions;
 	extensions.push_back("lua");
 	extensions.push_back("luau");
+	extensions.push_back("luauc");
 	return extensions;
 }
 
@@ -128,7 +314,7 @@ bool ResourceFormatLoaderLuauScript::_handles_type(const StringName &p_type) con
 String ResourceFormatLoaderLuauScript::_get_resource_type(const String &p_path) const
 {
 	String extension = p_path.get_extension().to_lower();
-	if (extension == "lua" || extension == "luau")
+	if (extension == "lua" || extension == "luau" || extension == "luauc")
 	{
 		return "LuauScript";
 	}
@@ -139,6 +325,7 @@ Error ResourceFormatSaverLuauScript::_save(const Ref<Resource> &p_resource, cons
 {
 	Ref<LuauScript> script = p_resource;
 	ERR_FAIL_COND_V_MSG(script.is_null(), ERR_INVALID_PARAMETER, "Invalid LuauScript resource.");
+	ERR_FAIL_COND_V_MSG(script->is_precompiled(), ERR_UNAVAILABLE, "Cannot save a precompiled LuauScript, as it has no source code.");
 
 	// TODO: Support persisting `compile_options` (maybe this needs a custom importer)
 
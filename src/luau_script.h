@@ -1,6 +1,7 @@
 #pragma once
 
 #include "lua_compileoptions.h"
+#include "luau_compile_task.h"
 
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/classes/resource_format_loader.hpp>
@@ -11,6 +12,10 @@ namespace gdluau
 {
 	using namespace godot;
 
+	// Precompiled script files (.luauc) hold the bytecode together with the options it was compiled with
+	PackedByteArray encode_precompiled_script(const PackedByteArray &p_bytecode, const LuaCompileOptions *p_options);
+	Error decode_precompiled_script(const PackedByteArray &p_data, PackedByteArray &r_bytecode, Ref<LuaCompileOptions> &r_options);
+
 	class LuauScript : public Resource
 	{
 		GDCLASS(LuauScript, Resource)
@@ -19,6 +24,10 @@ namespace gdluau
 		String source_code;
 		Ref<LuaCompileOptions> compile_options;
 		PackedByteArray cached_bytecode;
+		bool precompiled = false; // Loaded from a .luauc file, without source code
+		Ref<LuauCompileTask> pending_compile; // Started by compile_async(), collected by compile()
+
+		String get_bytecode_cache_key() const;
 
 	protected:
 		static void _bind_methods();
@@ -35,6 +44,14 @@ namespace gdluau
 		LuaCompileOptions *get_compile_options() const;
 
 		const PackedByteArray &compile(bool p_force_recompile = false);
+		void compile_async();
+
+		// Fills the in-memory bytecode from the on-disk cache, without compiling on a miss
+		bool load_cached_bytecode();
+
+		// Replaces the source with bytecode compiled ahead of time, so compile() never invokes the compiler
+		void set_precompiled_bytecode(const PackedByteArray &p_bytecode, const Ref<LuaCompileOptions> &p_options);
+		bool is_precompiled() const;
 	};
 
 	class ResourceFormatLoaderLuauScript : public ResourceFormatLoader
@@ -1,9 +1,13 @@
 #include "register_types.h"
 
+#include "bytecode_cache.h"
+#include "editor/luau_export_plugin.h"
 #include "lua_compileoptions.h"
 #include "lua_debug.h"
+#include "lua_function_handle.h"
 #include "lua_state.h"
 #include "luau.h"
+#include "luau_compile_task.h"
 #include "luau_script.h"
 #include "static_strings.h"
 #include "string_cache.h"
@@ -11,7 +15,9 @@
 #include <gdextension_interface.h>
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/godot.hpp>
+#include <godot_cpp/classes/editor_plugin_registration.hpp>
 #include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
 #include <godot_cpp/classes/resource_saver.hpp>
 #include <Luau/Common.h>
@@ -33,11 +39,68 @@ static int assertionHandler(const char *expr, const char *file, int line, const
     return 1;
 }
 
+// Registers the string cache capacity setting (if needed) and returns its value
+static size_t string_cache_capacity_setting()
+{
+    const String setting = "luau/string_cache/capacity";
+    const int64_t default_capacity = static_cast<int64_t>(DEFAULT_CACHE_CAPACITY);
+
+    ProjectSettings *settings = ProjectSettings::get_singleton();
+    if (!settings->has_setting(setting))
+    {
+        settings->set_setting(setting, default_capacity);
+    }
+
+    settings->set_initial_value(setting, default_capacity);
+    settings->set_restart_if_changed(setting, true);
+
+    Dictionary info;
+    info["name"] = setting;
+    info["type"] = Variant::INT;
+    info["hint"] = PROPERTY_HINT_RANGE;
+    info["hint_string"] = vformat("%d,%d,1", static_cast<int64_t>(MIN_CACHE_CAPACITY), static_cast<int64_t>(MAX_CACHE_CAPACITY));
+    settings->add_property_info(info);
+
+    int64_t capacity = settings->get_setting(setting);
+    return capacity > 0 ? static_cast<size_t>(capacity) : DEFAULT_CACHE_CAPACITY;
+}
+
+// Registers the bytecode cache setting (if needed) and returns its value
+static bool bytecode_cache_enabled_setting()
+{
+    const String setting = "luau/bytecode_cache/enabled";
+
+    ProjectSettings *settings = ProjectSettings::get_singleton();
+    if (!settings->has_setting(setting))
+    {
+        settings->set_setting(setting, true);
+    }
+
+    settings->set_initial_value(setting, true);
+    settings->set_restart_if_changed(setting, true);
+
+    Dictionary info;
+    info["name"] = setting;
+    info["type"] = Variant::BOOL;
+    settings->add_property_info(info);
+
+    return settings->get_setting(setting);
+}
+
 static Ref<ResourceFormatLoaderLuauScript> resource_loader_luau;
 static Ref<ResourceFormatSaverLuauScript> resource_saver_luau;
 
 void initialize_gdluau(ModuleInitializationLevel p_level)
 {
+    if (p_level == MODULE_INITIALIZATION_LEVEL_EDITOR)
+    {
+        // Precompiles scripts on export
+        GDREGISTER_INTERNAL_CLASS(LuauExportPlugin);
+        GDREGISTER_INTERNAL_CLASS(LuauEditorPlugin);
+        EditorPlugins::add_by_type<LuauEditorPlugin>();
+        return;
+    }
+
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE)
     {
         return;
@@ -45,7 +108,8 @@ void initialize_gdluau(ModuleInitializationLevel p_level)
 
     // Initialize statics (must be done after Godot is initialized, not during DLL static init)
     initialize_static_strings();
-    initialize_string_cache();
+    initialize_string_cache(string_cache_capacity_setting());
+    initialize_bytecode_cache(bytecode_cache_enabled_setting());
 
     // We generally try to avoid using the Luau C++ API (in favor of the C API),
     // for maximum compatibility with base Lua, but this appears to be the only
@@ -56,12 +120,14 @@ void initialize_gdluau(ModuleInitializationLevel p_level)
     GDREGISTER_RUNTIME_CLASS(gdluau::Luau);
     GDREGISTER_RUNTIME_CLASS(LuaCompileOptions);
     GDREGISTER_RUNTIME_CLASS(LuaDebug);
+    GDREGISTER_RUNTIME_CLASS(LuaFunctionHandle);
     GDREGISTER_RUNTIME_CLASS(LuaState);
+    GDREGISTER_RUNTIME_CLASS(LuauCompileTask);
     GDREGISTER_RUNTIME_CLASS(LuauScript);
     GDREGISTER_RUNTIME_CLASS(ResourceFormatLoaderLuauScript);
     GDREGISTER_RUNTIME_CLASS(ResourceFormatSaverLuauScript);
 
-    // Register resource loader and saver for .lua and .luau files
+    // Register resource loader and saver for .lua and .luau files (the loader also reads precompiled .luauc files)
     resource_loader_luau.instantiate();
     ResourceLoader::get_singleton()->add_resource_format_loader(resource_loader_luau);
 
@@ -71,6 +137,12 @@ void initialize_gdluau(ModuleInitializationLevel p_level)
 
 void uninitialize_gdluau(ModuleInitializationLevel p_level)
 {
+    if (p_level == MODULE_INITIALIZATION_LEVEL_EDITOR)
+    {
+        EditorPlugins::remove_by_type<LuauEditorPlugin>();
+        return;
+    }
+
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE)
     {
         return;
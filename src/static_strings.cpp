@@ -13,6 +13,7 @@ void gdluau::initialize_static_strings()
     static_strings->debugstep = StringName("debugstep");
     static_strings->push_to_lua = StringName("push_to_lua");
     static_strings->lua_userdata_tag = StringName("lua_userdata_tag");
+    static_strings->call = StringName("call");
 }
 
 void gdluau::uninitialize_static_strings()
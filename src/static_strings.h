@@ -13,6 +13,7 @@ namespace gdluau
         StringName debugstep;
         StringName push_to_lua;
         StringName lua_userdata_tag;
+        StringName call;
     };
 
     extern StaticStrings *static_strings;
@@ -1,161 +1,247 @@
 #include "string_cache.h"
 
-#include <godot_cpp/templates/spin_lock.hpp>
+#include <atomic>
+#include <thread>
 
 using namespace gdluau;
 using namespace godot;
 
+// Slots are filled at most once and never evicted, so each field is published
+// through its own state flag instead of a lock:
+//
+//   EMPTY -> WRITING: the thread that wins the CAS owns the field
+//   WRITING -> READY: release store after the field has been assigned
+//
+// Readers only touch a field after observing READY with acquire ordering, and
+// because the field never changes afterwards, no further synchronization is
+// needed to read or copy it.
+//
+// Strings are placed by linear probing from their hash slot. Because slots are
+// never emptied, every thread probes the same sequence for a given string and
+// settles on the same slot.
+enum SlotState : uint8_t
+{
+    SLOT_EMPTY,
+    SLOT_WRITING,
+    SLOT_READY,
+};
+
 struct CacheSlot
 {
     StringName str_name;
     CharString char_str;
+    std::atomic<uint8_t> str_name_state{SLOT_EMPTY};
+    std::atomic<uint8_t> char_str_state{SLOT_EMPTY};
 };
 
-constexpr size_t CACHE_MASK = CACHE_SIZE - 1;
-static_assert(CACHE_MASK <= INT16_MAX);
+static_assert(MAX_CACHE_CAPACITY - 1 <= INT16_MAX);
 
-// 64 KB cache (excluding the string contents), assuming this size.
+// 96 KB cache at the default capacity (excluding the string contents), assuming this size.
 // For comparison, Godot's own StringName interning is 512 KB.
 //
 // Assert because we don't want the cache to accidentally balloon if the engine types change.
-static_assert(sizeof(CacheSlot) <= 16);
+static_assert(sizeof(CacheSlot) <= 24);
 
 static CacheSlot *cache = nullptr;
-static SpinLock *cache_lock = nullptr;
+static size_t cache_capacity = 0;
+static size_t cache_mask = 0;
 
-void gdluau::initialize_string_cache()
+// Counters are striped across cache lines so that concurrent lookups don't contend on them
+struct alignas(64) CounterStripe
 {
-    cache = memnew_arr(CacheSlot, CACHE_SIZE);
-    cache_lock = memnew(SpinLock);
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> collisions{0};
+};
+
+constexpr unsigned COUNTER_STRIPES = 16;
+static CounterStripe counters[COUNTER_STRIPES];
+static std::atomic<uint64_t> used_slots{0};
+
+static CounterStripe &local_counters()
+{
+    static std::atomic<unsigned> next_stripe{0};
+    thread_local unsigned stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % COUNTER_STRIPES;
+    return counters[stripe];
 }
 
-void gdluau::uninitialize_string_cache()
+static void count(std::atomic<uint64_t> CounterStripe::*p_counter)
+{
+    (local_counters().*p_counter).fetch_add(1, std::memory_order_relaxed);
+}
+
+void gdluau::initialize_string_cache(size_t p_capacity)
 {
-    if (cache_lock != nullptr)
+    size_t capacity = MIN_CACHE_CAPACITY;
+    while (capacity < p_capacity && capacity < MAX_CACHE_CAPACITY)
     {
-        cache_lock->lock();
+        capacity <<= 1;
     }
 
+    cache = memnew_arr(CacheSlot, capacity);
+    cache_capacity = capacity;
+    cache_mask = capacity - 1;
+
+    for (CounterStripe &stripe : counters)
+    {
+        stripe.hits.store(0, std::memory_order_relaxed);
+        stripe.misses.store(0, std::memory_order_relaxed);
+        stripe.collisions.store(0, std::memory_order_relaxed);
+    }
+    used_slots.store(0, std::memory_order_relaxed);
+}
+
+void gdluau::uninitialize_string_cache()
+{
+    // No Lua state may be running at this point, so there are no concurrent readers to worry about
     if (cache != nullptr)
     {
         memdelete_arr(cache);
         cache = nullptr;
+        cache_capacity = 0;
+        cache_mask = 0;
     }
+}
 
-    if (cache_lock != nullptr)
-    {
-        cache_lock->unlock();
-
-        memdelete(cache_lock);
-        cache_lock = nullptr;
-    }
+size_t gdluau::get_string_cache_capacity()
+{
+    return cache_capacity;
 }
 
-static unsigned slot_for_string_name(const StringName &p_str_name)
+StringCacheStats gdluau::get_string_cache_stats()
 {
-    return static_cast<unsigned>(p_str_name.hash()) & CACHE_MASK;
+    StringCacheStats stats;
+    stats.capacity = cache_capacity;
+    stats.used = used_slots.load(std::memory_order_relaxed);
+
+    for (const CounterStripe &stripe : counters)
+    {
+        stats.hits += stripe.hits.load(std::memory_order_relaxed);
+        stats.misses += stripe.misses.load(std::memory_order_relaxed);
+        stats.collisions += stripe.collisions.load(std::memory_order_relaxed);
+    }
+
+    return stats;
 }
 
-int16_t gdluau::create_atom(const char *p_str, size_t p_len)
+// Waits out a concurrent fill of the slot's StringName, which is a single assignment.
+static uint8_t wait_for_str_name(const CacheSlot &p_slot, uint8_t p_state)
 {
-    ERR_FAIL_COND_V_MSG(p_len == 0, -1, "Cannot create atom for empty string.");
+    while (p_state == SLOT_WRITING) [[unlikely]]
+    {
+        std::this_thread::yield();
+        p_state = p_slot.str_name_state.load(std::memory_order_acquire);
+    }
 
-    StringName str_name(String::utf8(p_str, p_len));
+    return p_state;
+}
 
-    unsigned atom = slot_for_string_name(str_name);
-    bool slot_filled;
+// Returns the slot holding p_str_name, claiming an empty slot for it if necessary,
+// or -1 if the probe window is full of other strings.
+static int find_or_claim_slot(const StringName &p_str_name, bool &r_claimed)
+{
+    r_claimed = false;
 
-    cache_lock->lock();
+    size_t index = static_cast<size_t>(p_str_name.hash()) & cache_mask;
+    for (int probe = 0; probe < CACHE_MAX_PROBES; probe++, index = (index + 1) & cache_mask)
     {
-        StringName &slot = cache[atom].str_name;
-        if (slot.is_empty())
-        {
-            slot = std::move(str_name);
-            slot_filled = true;
-        }
-        else if (slot == str_name)
+        CacheSlot &slot = cache[index];
+
+        uint8_t state = slot.str_name_state.load(std::memory_order_acquire);
+        if (state == SLOT_EMPTY)
         {
-            // Return existing atom
-            slot_filled = true;
+            if (slot.str_name_state.compare_exchange_strong(state, SLOT_WRITING, std::memory_order_acquire))
+            {
+                slot.str_name = p_str_name;
+                slot.str_name_state.store(SLOT_READY, std::memory_order_release);
+                used_slots.fetch_add(1, std::memory_order_relaxed);
+
+                r_claimed = true;
+                return static_cast<int>(index);
+            }
+
+            // Lost the race: `state` now holds the winner's progress
         }
-        else [[unlikely]]
+
+        wait_for_str_name(slot, state);
+        if (slot.str_name == p_str_name)
         {
-            // Slot occupied by a different string
-            slot_filled = false;
+            return static_cast<int>(index);
         }
     }
-    cache_lock->unlock();
 
-    if (slot_filled) [[likely]]
-    {
-        return static_cast<int16_t>(atom);
-    }
-    else
+    return -1;
+}
+
+int16_t gdluau::create_atom(const char *p_str, size_t p_len)
+{
+    ERR_FAIL_COND_V_MSG(p_len == 0, -1, "Cannot create atom for empty string.");
+
+    StringName str_name(String::utf8(p_str, p_len));
+
+    bool claimed;
+    int atom = find_or_claim_slot(str_name, claimed);
+    if (atom < 0) [[unlikely]]
     {
+        // Probe window occupied by other strings.
         // Ideally we would evict at this point, but that could introduce a race
         // condition if the pre-existing atom is being used on another thread
+        count(&CounterStripe::collisions);
         return -1;
     }
+
+    count(claimed ? &CounterStripe::misses : &CounterStripe::hits);
+    return static_cast<int16_t>(atom);
 }
 
 StringName gdluau::string_name_for_atom(int p_atom)
 {
-    ERR_FAIL_COND_V_MSG(p_atom >= static_cast<int>(CACHE_SIZE), StringName(), "Invalid atom index.");
+    ERR_FAIL_COND_V_MSG(p_atom >= static_cast<int>(cache_capacity), StringName(), "Invalid atom index.");
 
     if (p_atom < 0) [[unlikely]]
     {
         return StringName();
     }
 
-    cache_lock->lock();
-    // Taking a reference is safe because we don't evict entries once filled
-    const StringName &str_name = cache[p_atom].str_name;
-    cache_lock->unlock();
+    const CacheSlot &slot = cache[p_atom];
+    uint8_t state = wait_for_str_name(slot, slot.str_name_state.load(std::memory_order_acquire));
+    if (state != SLOT_READY) [[unlikely]]
+    {
+        return StringName();
+    }
 
-    return str_name;
+    return slot.str_name;
 }
 
 CharString gdluau::char_string(const StringName &p_str_name)
 {
     ERR_FAIL_COND_V_MSG(p_str_name.is_empty(), CharString(), "Cannot cache CharString for empty StringName.");
 
-    unsigned atom = slot_for_string_name(p_str_name);
-    bool different_string_in_slot = false;
-    CharString char_str;
-
-    // Try retrieving from cache
-    cache_lock->lock();
+    bool claimed;
+    int index = find_or_claim_slot(p_str_name, claimed);
+    if (index < 0) [[unlikely]]
     {
-        CacheSlot &slot = cache[atom];
-        if (slot.str_name.is_empty())
-        {
-            slot.str_name = p_str_name;
-        }
-        else if (slot.str_name == p_str_name) [[likely]]
-        {
-            // Cache hit
-            char_str = slot.char_str;
-        }
-        else [[unlikely]]
-        {
-            different_string_in_slot = true;
-        }
+        count(&CounterStripe::collisions);
+        return String(p_str_name).utf8();
     }
-    cache_lock->unlock();
 
-    if (char_str.size() > 0) [[likely]]
+    CacheSlot &slot = cache[index];
+    if (slot.char_str_state.load(std::memory_order_acquire) == SLOT_READY) [[likely]]
     {
-        return char_str;
+        count(&CounterStripe::hits);
+        return slot.char_str;
     }
 
     // Cache miss: build CharString
-    char_str = String(p_str_name).utf8();
-    if (!different_string_in_slot) [[likely]]
+    count(&CounterStripe::misses);
+    CharString char_str = String(p_str_name).utf8();
+
+    // Populate cache, unless another thread is already doing so
+    uint8_t expected = SLOT_EMPTY;
+    if (slot.char_str_state.compare_exchange_strong(expected, SLOT_WRITING, std::memory_order_acquire))
     {
-        // Populate cache
-        cache_lock->lock();
-        cache[atom].char_str = char_str;
-        cache_lock->unlock();
+        slot.char_str = char_str;
+        slot.char_str_state.store(SLOT_READY, std::memory_order_release);
     }
 
     return char_str;
@@ -3,16 +3,40 @@
 #include <godot_cpp/variant/char_string.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 
+#include <cstdint>
+
 namespace gdluau
 {
     using namespace godot;
 
     // String cache configuration
-    constexpr size_t CACHE_SIZE = 1 << 12; // 4096 entries
+    constexpr size_t DEFAULT_CACHE_CAPACITY = 1 << 12; // 4096 entries
+    constexpr size_t MIN_CACHE_CAPACITY = 1 << 8;
+    constexpr size_t MAX_CACHE_CAPACITY = 1 << 15; // Atoms are int16_t
+
+    // Number of slots probed (linear probing) before a string is considered a collision
+    constexpr int CACHE_MAX_PROBES = 8;
+
+    struct StringCacheStats
+    {
+        uint64_t capacity = 0;
+        uint64_t used = 0;
 
-    void initialize_string_cache();
+        // Lookups served from the cache
+        uint64_t hits = 0;
+        // Lookups that had to fill the cache (new atom, or first CharString conversion)
+        uint64_t misses = 0;
+        // Lookups that found no slot within the probe window, and so bypassed the cache
+        uint64_t collisions = 0;
+    };
+
+    // Capacity is clamped to [MIN_CACHE_CAPACITY, MAX_CACHE_CAPACITY] and rounded up to a power of two
+    void initialize_string_cache(size_t p_capacity = DEFAULT_CACHE_CAPACITY);
     void uninitialize_string_cache();
 
+    size_t get_string_cache_capacity();
+    StringCacheStats get_string_cache_stats();
+
     int16_t create_atom(const char *p_str, size_t p_len);
     StringName string_name_for_atom(int p_atom);
 
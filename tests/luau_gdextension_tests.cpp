@@ -3,6 +3,8 @@
 
 #include "luau_gdextension_tests.h"
 
+#include "bytecode_cache.h"
+
 #define DOCTEST_CONFIG_IMPLEMENT
 #include "doctest.h"
 
@@ -45,9 +47,16 @@ Dictionary LuauGDExtensionTests::run()
 	context.setOption("duration", true);   // Show test durations
 	// Run all tests (no filter)
 
+	// Keep tests from writing into the project's bytecode cache. Tests that exercise the cache
+	// enable it themselves (see BytecodeCacheFixture) and remove what they write.
+	bool bytecode_cache_was_enabled = gdluau::is_bytecode_cache_enabled();
+	gdluau::initialize_bytecode_cache(false);
+
 	// Run all tests - doctest outputs results to stdout
 	int result = context.run();
 
+	gdluau::initialize_bytecode_cache(bytecode_cache_was_enabled);
+
 	// doctest doesn't expose internal stats directly via getters.
 	// Results are printed to stdout, and run() returns 0 on success, non-zero on failure.
 	// For detailed stats, parse the stdout output or use a custom reporter.
@@ -3,6 +3,7 @@
 
 #include "doctest.h"
 #include "test_fixtures.h"
+#include "bridging/array.h"
 #include "lua_state.h"
 
 using namespace gdluau;
@@ -307,6 +308,122 @@ TEST_SUITE("Bridging - Array")
         state->pop(1);
     }
 
+    TEST_CASE_FIXTURE(LuaStateFixture, "is_array - hole in the array part")
+    {
+        CHECK(exec_lua("local t = table.create(4); t[1] = 1; t[2] = 2; t[4] = 4; return t") == LUA_OK);
+
+        CHECK_FALSE(state->is_array(-1));
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_array - stops at a hole in the array part")
+    {
+        CHECK(exec_lua("local t = table.create(4); t[1] = 1; t[2] = 2; t[4] = 4; return t") == LUA_OK);
+
+        bool is_array = true;
+        Array result = to_array(L, -1, &is_array);
+
+        CHECK_FALSE(is_array);
+        CHECK(result.size() == 2);
+        CHECK(static_cast<int>(result[1]) == 2);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_array - large array")
+    {
+        CHECK(exec_lua("local t = {}; for i = 1, 1000 do t[i] = i * 2 end; t[1001] = 'last'; return t") == LUA_OK);
+
+        Array result = state->to_array(-1);
+
+        CHECK(result.size() == 1001);
+        CHECK(static_cast<int>(result[0]) == 2);
+        CHECK(static_cast<int>(result[999]) == 2000);
+        CHECK(static_cast<String>(result[1000]) == "last");
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_array_typed - converts elements to the element type")
+    {
+        CHECK(exec_lua("return {1, 2.5, 3}") == LUA_OK);
+
+        Array result = state->to_array_typed(-1, Variant::FLOAT);
+
+        CHECK(result.is_typed());
+        CHECK(result.get_typed_builtin() == Variant::FLOAT);
+        REQUIRE(result.size() == 3);
+        CHECK(result[0].get_type() == Variant::FLOAT);
+        CHECK(static_cast<double>(result[0]) == 1.0);
+        CHECK(static_cast<double>(result[1]) == 2.5);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_array_typed - StringName and Vector2 elements")
+    {
+        CHECK(exec_lua("return {'idle', 'run'}, {Vector2(1, 2), Vector2(3, 4)}") == LUA_OK);
+
+        Array names = state->to_array_typed(-2, Variant::STRING_NAME);
+        REQUIRE(names.size() == 2);
+        CHECK(names[1].get_type() == Variant::STRING_NAME);
+        CHECK(static_cast<StringName>(names[1]) == StringName("run"));
+
+        Array points = state->to_array_typed(-1, Variant::VECTOR2);
+        REQUIRE(points.size() == 2);
+        CHECK(static_cast<Vector2>(points[1]) == Vector2(3, 4));
+
+        state->pop(2);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_array_typed - element of the wrong type fails")
+    {
+        CHECK(exec_lua("return {1, 'two', 3}") == LUA_OK);
+        int top = state->get_top();
+
+        Array result = state->to_array_typed(-1, Variant::FLOAT);
+
+        CHECK(result.is_typed());
+        CHECK(result.size() == 0);
+        CHECK(state->get_top() == top);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_array_typed - non-integral number for an int element fails")
+    {
+        CHECK(exec_lua("return {1, 2}, {1, 1.5}") == LUA_OK);
+
+        Array whole = state->to_array_typed(-2, Variant::INT);
+        REQUIRE(whole.size() == 2);
+        CHECK(whole[1].get_type() == Variant::INT);
+        CHECK(static_cast<int>(whole[1]) == 2);
+
+        // 1.5 isn't truncated to 1
+        Array fractional = state->to_array_typed(-1, Variant::INT);
+        CHECK(fractional.is_typed());
+        CHECK(fractional.size() == 0);
+
+        state->pop(2);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_array - typed array")
+    {
+        Array arr;
+        arr.set_typed(Variant::INT, StringName(), Variant());
+        arr.push_back(10);
+        arr.push_back(20);
+
+        state->push_array(arr);
+        state->set_global("arr");
+
+        CHECK(exec_lua("return #arr, arr[1] + arr[2]") == LUA_OK);
+        CHECK(state->to_number(-2) == 2);
+        CHECK(state->to_number(-1) == 30);
+        state->pop(2);
+    }
+
     TEST_CASE_FIXTURE(LuaStateFixture, "round-trip - array to Lua and back")
     {
         Array original;
@@ -0,0 +1,121 @@
+// Tests for bridging/buffer_view - zero-copy PackedByteArray views
+// is_buffer_view, to_buffer_view, push_buffer_view
+
+#include "doctest.h"
+#include "test_fixtures.h"
+#include "lua_state.h"
+
+using namespace gdluau;
+using namespace godot;
+
+static PackedByteArray make_bytes(std::initializer_list<uint8_t> p_values)
+{
+    PackedByteArray bytes;
+    for (uint8_t value : p_values)
+    {
+        bytes.push_back(value);
+    }
+    return bytes;
+}
+
+TEST_SUITE("Bridging - Buffer View")
+{
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_buffer_view - is a view, not a buffer")
+    {
+        state->push_buffer_view(make_bytes({1, 2, 3}));
+
+        CHECK(state->is_buffer_view(-1));
+        CHECK(state->is_userdata(-1));
+        CHECK_FALSE(state->is_buffer(-1));
+
+        state->pop(1);
+
+        lua_newbuffer(L, 4);
+        CHECK_FALSE(state->is_buffer_view(-1));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_buffer_view - reads without copying")
+    {
+        PackedByteArray bytes = make_bytes({0x01, 0x02, 0x03, 0x04, 'h', 'i'});
+        state->push_buffer_view(bytes);
+        state->set_global("view");
+
+        CHECK(exec_lua("return #view, view:len(), view:readu8(0), view:readu16(0), view:readu32(0), view:readstring(4, 2)") == LUA_OK);
+        CHECK(state->to_number(-6) == 6);
+        CHECK(state->to_number(-5) == 6);
+        CHECK(state->to_number(-4) == 0x01);
+        CHECK(state->to_number(-3) == 0x0201);
+        CHECK(state->to_number(-2) == 0x04030201);
+        CHECK(String(state->to_string_inplace(-1)) == "hi");
+        state->pop(6);
+
+        // Converting back shares the same data
+        state->get_global("view");
+        PackedByteArray result = state->to_variant(-1);
+        CHECK(result.ptr() == bytes.ptr());
+
+        PackedByteArray buffer = state->to_buffer(-1);
+        CHECK(buffer.ptr() == bytes.ptr());
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_buffer_view - writes are copy-on-write")
+    {
+        PackedByteArray bytes = make_bytes({0, 0, 0, 0, 0, 0, 0, 0});
+        state->push_buffer_view(bytes);
+        state->set_global("view");
+
+        exec_lua_ok("view:writeu8(0, 255); view:writei16(2, -2); view:writef32(4, 1.5)");
+
+        // Original array is untouched
+        CHECK(bytes[0] == 0);
+        CHECK(bytes[2] == 0);
+
+        state->get_global("view");
+        PackedByteArray result = state->to_variant(-1);
+        CHECK(result.ptr() != bytes.ptr());
+        CHECK(result[0] == 255);
+        CHECK(result.decode_s16(2) == -2);
+        CHECK(result.decode_float(4) == doctest::Approx(1.5));
+        state->pop(1);
+
+        CHECK(exec_lua("return view:readi16(2), view:readf32(4)") == LUA_OK);
+        CHECK(state->to_number(-2) == -2);
+        CHECK(state->to_number(-1) == doctest::Approx(1.5));
+        state->pop(2);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_buffer_view - copying helpers")
+    {
+        state->push_buffer_view(make_bytes({'a', 'b', 'c'}));
+        state->set_global("view");
+
+        CHECK(exec_lua("local b = view:tobuffer(); return buffer.len(b), buffer.readstring(b, 0, 3), view:tostring()") == LUA_OK);
+        CHECK(state->to_number(-3) == 3);
+        CHECK(String(state->to_string_inplace(-2)) == "abc");
+        CHECK(String(state->to_string_inplace(-1)) == "abc");
+        state->pop(3);
+
+        exec_lua_ok("view:fill(0, 120); view:writestring(1, 'yz')");
+        CHECK(exec_lua("return view:tostring()") == LUA_OK);
+        CHECK(String(state->to_string_inplace(-1)) == "xyz");
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_buffer_view - out of bounds access errors")
+    {
+        state->push_buffer_view(make_bytes({1, 2, 3, 4}));
+        state->set_global("view");
+
+        CHECK(exec_lua("return view:readu32(1)") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("out of bounds"));
+        state->pop(1);
+
+        CHECK(exec_lua("view:writeu8(-1, 0)") == LUA_ERRRUN);
+        state->pop(1);
+
+        CHECK(exec_lua("return view:readstring(2, 3)") == LUA_ERRRUN);
+        state->pop(1);
+    }
+}
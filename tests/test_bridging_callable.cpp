@@ -98,6 +98,49 @@ TEST_SUITE("Bridging - Callable")
         CHECK(static_cast<int>(result) == 1);
     }
 
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_callable - multiple_returns returns an Array")
+    {
+        exec_lua_ok(R"(
+            function multi_return(x)
+                return x, x * 2, "three"
+            end
+
+            function no_return()
+            end
+
+            function error_func()
+                error("intentional error")
+            end
+        )");
+
+        state->get_global("multi_return");
+        Callable callable = state->to_callable(-1, true);
+        state->pop(1);
+
+        Array result = callable.call(5);
+        REQUIRE(result.size() == 3);
+        CHECK(static_cast<int>(result[0]) == 5);
+        CHECK(static_cast<int>(result[1]) == 10);
+        CHECK(result[2] == Variant("three"));
+
+        state->get_global("no_return");
+        Callable no_return = state->to_callable(-1, true);
+        state->pop(1);
+
+        Variant empty = no_return.call();
+        REQUIRE(empty.get_type() == Variant::ARRAY);
+        Array empty_array = empty;
+        CHECK(empty_array.is_empty());
+
+        state->get_global("error_func");
+        Callable error_func = state->to_callable(-1, true);
+        state->pop(1);
+
+        Variant failed = error_func.call();
+        CHECK(failed.get_type() == Variant::ARRAY);
+        CHECK(state->get_top() == 0);
+    }
+
     TEST_CASE_FIXTURE(LuaStateFixture, "to_callable - with no return value")
     {
         exec_lua_ok(R"(
@@ -145,6 +188,21 @@ TEST_SUITE("Bridging - Callable")
         state->pop(1);
     }
 
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_callable - calling from Lua")
+    {
+        state->push_callable(Callable(state.ptr(), "get_top"));
+        state->set_global("get_top");
+
+        // Arguments and the Callable itself are popped before the call
+        CHECK(exec_lua("return get_top()") == LUA_OK);
+        CHECK(state->to_number(-1) == 0);
+        state->pop(1);
+
+        CHECK(exec_lua("get_top(1, 2)") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("too many arguments"));
+        state->pop(1);
+    }
+
     TEST_CASE("callable - persists across LuaState lifetime")
     {
         Callable callable;
@@ -171,6 +229,25 @@ TEST_SUITE("Bridging - Callable")
         CHECK(result.get_type() == Variant::NIL);
     }
 
+    TEST_CASE("callable - invalid after LuaState is closed")
+    {
+        Ref<LuaState> state;
+        state.instantiate();
+        state->do_string("return function() return 1 end", "test", 0, 0, 1);
+
+        Callable callable = state->to_callable(-1);
+        state->pop(1);
+
+        CHECK(callable.is_valid());
+        CHECK(static_cast<int>(callable.call()) == 1);
+
+        state->close();
+
+        // The LuaState object is still alive, but its VM is gone
+        CHECK_FALSE(callable.is_valid());
+        CHECK(callable.call().get_type() == Variant::NIL);
+    }
+
     TEST_CASE_FIXTURE(LuaStateFixture, "integration - passing Lua function to Lua")
     {
         exec_lua_ok(R"(
@@ -338,4 +415,66 @@ TEST_SUITE("Bridging - Callable")
         Variant result = callable.callv(args);
         CHECK(static_cast<int>(result) == 42);
     }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_callable - reassigned __call metamethods take effect")
+    {
+        exec_lua_ok(R"(
+            calls = 0
+            callable_table = setmetatable({ factor = 3 }, {
+                __call = function(self, x)
+                    calls += 1
+                    return self.factor * x
+                end
+            })
+        )");
+
+        state->get_global("callable_table");
+        Callable callable = state->to_callable(-1);
+        state->pop(1);
+
+        CHECK(static_cast<int>(callable.call(2)) == 6);
+        CHECK(static_cast<int>(callable.call(4)) == 12);
+
+        exec_lua_ok("getmetatable(callable_table).__call = function() return -1 end");
+        CHECK(static_cast<int>(callable.call(5)) == -1);
+
+        exec_lua_ok("setmetatable(callable_table, { __call = function(self, x) return x + 1 end })");
+        CHECK(static_cast<int>(callable.call(5)) == 6);
+
+        exec_lua_ok("assert(calls == 2)");
+        CHECK(state->get_top() == 0);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_callable - reassigned __call in a nested chain takes effect")
+    {
+        exec_lua_ok(R"(
+            inner_table = setmetatable({}, {
+                __call = function(self, x) return x * 2 end
+            })
+            outer_table = setmetatable({}, { __call = inner_table })
+        )");
+
+        state->get_global("outer_table");
+        Callable callable = state->to_callable(-1);
+        state->pop(1);
+
+        CHECK(static_cast<int>(callable.call(5)) == 10);
+
+        // Only the inner link of the chain changes
+        exec_lua_ok("getmetatable(inner_table).__call = function(self, x) return x * 3 end");
+        CHECK(static_cast<int>(callable.call(5)) == 15);
+
+        CHECK(state->get_top() == 0);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_callable - table without __call fails to call")
+    {
+        exec_lua_ok("return {}");
+        Callable callable = state->to_callable(-1);
+        state->pop(1);
+
+        Variant result = callable.call();
+        CHECK(result.get_type() == Variant::NIL);
+        CHECK(state->get_top() == 0);
+    }
 }
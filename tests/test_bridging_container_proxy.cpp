@@ -0,0 +1,174 @@
+// Tests for bridging/container_proxy - lazy Array and Dictionary proxies
+// push_variant_proxy, reads and writes through the shared container
+
+#include "doctest.h"
+#include "test_fixtures.h"
+#include "lua_state.h"
+
+using namespace gdluau;
+using namespace godot;
+
+TEST_SUITE("Bridging - Container Proxy")
+{
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_variant_proxy - containers are shared, not copied")
+    {
+        Dictionary dict;
+        dict["a"] = 1;
+        state->push_variant_proxy(dict);
+
+        CHECK(state->is_userdata(-1));
+        CHECK_FALSE(state->is_table(-1));
+
+        Variant result = state->to_variant(-1);
+        CHECK(result.get_type() == Variant::DICTIONARY);
+        result.set("b", 2);
+        CHECK(dict.has("b"));
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_variant_proxy - other values are pushed as usual")
+    {
+        state->push_variant_proxy(42);
+        CHECK(state->is_number(-1));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "Array proxy - reads with 1-based indices")
+    {
+        state->push_variant_proxy(Array::make(10, "two", 30));
+        state->set_global("arr");
+
+        CHECK(exec_lua("return #arr, arr[1], arr[2], arr[4], arr[0]") == LUA_OK);
+        CHECK(state->to_number(-5) == 3);
+        CHECK(state->to_number(-4) == 10);
+        CHECK(String(state->to_string_inplace(-3)) == "two");
+        CHECK(state->is_nil(-2));
+        CHECK(state->is_nil(-1));
+        state->pop(5);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "Array proxy - writes go to the shared Array")
+    {
+        Array arr = Array::make(1, 2);
+        state->push_variant_proxy(arr);
+        state->set_global("arr");
+
+        exec_lua_ok("arr[1] = 'one'; arr[#arr + 1] = 3");
+
+        REQUIRE(arr.size() == 3);
+        CHECK(arr[0] == Variant("one"));
+        CHECK(static_cast<int>(arr[2]) == 3);
+
+        CHECK(exec_lua("arr[5] = 5") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("out of range"));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "Array proxy - typed arrays convert written values")
+    {
+        Array arr;
+        arr.set_typed(Variant::FLOAT, StringName(), Variant());
+        arr.push_back(0.5);
+        state->push_variant_proxy(arr);
+        state->set_global("arr");
+
+        exec_lua_ok("arr[1] = 2");
+        CHECK(arr[0].get_type() == Variant::FLOAT);
+        CHECK(static_cast<double>(arr[0]) == 2.0);
+
+        CHECK(exec_lua("arr[1] = 'two'") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("float"));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "Array proxy - iterates and calls methods")
+    {
+        Array arr = Array::make(3, 1, 2);
+        state->push_variant_proxy(arr);
+        state->set_global("arr");
+
+        CHECK(exec_lua(R"(
+            local index_sum, total = 0, 0
+            for i, v in arr do
+                index_sum += i
+                total += v
+            end
+            arr:sort()
+            return index_sum, total, arr:has(2)
+        )") == LUA_OK);
+        CHECK(state->to_number(-3) == 6);
+        CHECK(state->to_number(-2) == 6);
+        CHECK(state->to_boolean(-1));
+        state->pop(3);
+
+        CHECK(static_cast<int>(arr[0]) == 1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "Dictionary proxy - reads and writes through")
+    {
+        Dictionary dict;
+        dict["name"] = "Player";
+        dict["health"] = 100;
+        state->push_variant_proxy(dict);
+        state->set_global("dict");
+
+        CHECK(exec_lua("return dict.name, dict.missing, #dict") == LUA_OK);
+        CHECK(String(state->to_string_inplace(-3)) == "Player");
+        CHECK(state->is_nil(-2));
+        CHECK(state->to_number(-1) == 2);
+        state->pop(3);
+
+        exec_lua_ok("dict.health -= 10; dict.level = 2; dict.name = nil");
+        CHECK(static_cast<int>(dict["health"]) == 90);
+        CHECK(static_cast<int>(dict["level"]) == 2);
+        CHECK_FALSE(dict.has("name"));
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "Dictionary proxy - nested containers are proxied")
+    {
+        Dictionary inner;
+        inner["x"] = 1;
+        Dictionary outer;
+        outer["inner"] = inner;
+        outer["list"] = Array::make(1, 2);
+        state->push_variant_proxy(outer);
+        state->set_global("outer");
+
+        exec_lua_ok("outer.inner.x = 5; outer.list[3] = 3");
+        CHECK(static_cast<int>(inner["x"]) == 5);
+        Array list = outer["list"];
+        CHECK(list.size() == 3);
+
+        CHECK(exec_lua("return outer.inner == outer.inner") == LUA_OK);
+        CHECK(state->to_boolean(-1));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "Dictionary proxy - typed keys and iteration")
+    {
+        Dictionary dict;
+        dict.set_typed(Variant::STRING_NAME, StringName(), Variant(), Variant::INT, StringName(), Variant());
+        dict[StringName("a")] = 1;
+        dict[StringName("b")] = 2;
+        state->push_variant_proxy(dict);
+        state->set_global("dict");
+
+        CHECK(exec_lua(R"(
+            local keys, total = '', 0
+            for k, v in dict do
+                keys ..= k
+                total += v
+            end
+            return keys, total, dict.b
+        )") == LUA_OK);
+        CHECK(String(state->to_string_inplace(-3)) == "ab");
+        CHECK(state->to_number(-2) == 3);
+        CHECK(state->to_number(-1) == 2);
+        state->pop(3);
+
+        CHECK(exec_lua("dict.c = 'three'") == LUA_ERRRUN);
+        state->pop(1);
+        CHECK_FALSE(dict.has(StringName("c")));
+    }
+}
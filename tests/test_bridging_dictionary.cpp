@@ -278,6 +278,72 @@ TEST_SUITE("Bridging - Dictionary")
         state->pop(1);
     }
 
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_dictionary_typed - StringName keys and Vector3 values")
+    {
+        CHECK(exec_lua("return {spawn = Vector3(0, 1, 0), goal = Vector3(5, 0, 5)}") == LUA_OK);
+
+        Dictionary result = state->to_dictionary_typed(-1, Variant::STRING_NAME, Variant::VECTOR3);
+
+        CHECK(result.is_typed());
+        CHECK(result.get_typed_key_builtin() == Variant::STRING_NAME);
+        CHECK(result.get_typed_value_builtin() == Variant::VECTOR3);
+        REQUIRE(result.size() == 2);
+        CHECK(static_cast<Vector3>(result[StringName("goal")]) == Vector3(5, 0, 5));
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_dictionary_typed - untyped values")
+    {
+        CHECK(exec_lua("return {health = 100, name = 'Player'}") == LUA_OK);
+
+        Dictionary result = state->to_dictionary_typed(-1, Variant::STRING, Variant::NIL);
+
+        CHECK(result.get_typed_key_builtin() == Variant::STRING);
+        CHECK_FALSE(result.is_typed_value());
+        CHECK(result["name"] == Variant("Player"));
+        CHECK(static_cast<int>(result["health"]) == 100);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_dictionary_typed - value of the wrong type fails")
+    {
+        CHECK(exec_lua("return {a = 1, b = 'two'}") == LUA_OK);
+        int top = state->get_top();
+
+        Dictionary result = state->to_dictionary_typed(-1, Variant::STRING, Variant::INT);
+
+        CHECK(result.size() == 0);
+        CHECK(state->get_top() == top);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_dictionary_typed - non-integral number for an int key fails")
+    {
+        CHECK(exec_lua("return {[1.5] = 'half'}") == LUA_OK);
+
+        Dictionary result = state->to_dictionary_typed(-1, Variant::INT, Variant::STRING);
+        CHECK(result.size() == 0);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_dictionary - typed dictionary")
+    {
+        Dictionary dict;
+        dict.set_typed(Variant::STRING_NAME, StringName(), Variant(), Variant::FLOAT, StringName(), Variant());
+        dict[StringName("speed")] = 2.5;
+
+        state->push_dictionary(dict);
+        state->set_global("dict");
+
+        CHECK(exec_lua("return dict.speed") == LUA_OK);
+        CHECK(state->to_number(-1) == 2.5);
+        state->pop(1);
+    }
+
     TEST_CASE_FIXTURE(LuaStateFixture, "round-trip - dictionary to Lua and back")
     {
         Dictionary original;
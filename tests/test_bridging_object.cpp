@@ -3,6 +3,8 @@
 
 #include "doctest.h"
 #include "test_fixtures.h"
+#include "bridging/object.h"
+#include "lua_compileoptions.h"
 #include "lua_state.h"
 
 using namespace gdluau;
@@ -167,6 +169,18 @@ TEST_SUITE("Bridging - Object")
         CHECK(state->is_function(-1));
         state->pop(1);
 
+        state->get_field(-1, "__namecall");
+        CHECK(state->is_function(-1));
+        state->pop(1);
+
+        state->get_field(-1, "__index");
+        CHECK(state->is_function(-1));
+        state->pop(1);
+
+        state->get_field(-1, "__newindex");
+        CHECK(state->is_function(-1));
+        state->pop(1);
+
         state->pop(1); // Pop metatable
     }
 
@@ -363,4 +377,140 @@ TEST_SUITE("Bridging - Object")
             state->pop(1);
         }
     }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "method calls - namecall dispatches to Godot methods")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        state->push_object(opts.ptr());
+        state->set_global("opts");
+
+        exec_lua_ok(R"(
+            opts:set_optimization_level(2)
+            result = opts:get_optimization_level()
+        )");
+        CHECK(opts->get_optimization_level() == 2);
+
+        state->get_global("result");
+        CHECK(state->to_number(-1) == 2.0);
+        state->pop(1);
+
+        // Repeated calls go through the cache
+        exec_lua_ok(R"(
+            for i = 0, 2 do
+                opts:set_debug_level(i)
+                assert(opts:get_debug_level() == i)
+            end
+        )");
+        CHECK(opts->get_debug_level() == 2);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "method calls - index returns callable method")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        state->push_object(opts.ptr());
+        state->set_global("opts");
+
+        exec_lua_ok(R"(
+            local setter = opts.set_coverage_level
+            setter(opts, 1)
+        )");
+        CHECK(opts->get_coverage_level() == 1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "method calls - errors")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        state->push_object(opts.ptr());
+        state->set_global("opts");
+
+        SUBCASE("Unknown method")
+        {
+            CHECK(exec_lua("opts:does_not_exist()") != LUA_OK);
+            CHECK(state->to_string_inplace(-1).contains("does_not_exist"));
+            state->pop(1);
+        }
+
+        SUBCASE("Wrong argument type")
+        {
+            CHECK(exec_lua("opts:set_optimization_level({})") != LUA_OK);
+            CHECK(state->to_string_inplace(-1).contains("set_optimization_level"));
+            state->pop(1);
+        }
+
+        SUBCASE("Too few arguments")
+        {
+            CHECK(exec_lua("opts:set_optimization_level()") != LUA_OK);
+            state->pop(1);
+        }
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "properties - read and write through accessors")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+        opts->set_debug_level(2);
+
+        state->push_object(opts.ptr());
+        state->set_global("opts");
+
+        exec_lua_ok(R"(
+            assert(opts.debug_level == 2)
+            opts.optimization_level = 0
+            opts.native_codegen = true
+            for i = 0, 2 do
+                opts.coverage_level = i
+                assert(opts.coverage_level == i)
+            end
+        )");
+
+        CHECK(opts->get_optimization_level() == 0);
+        CHECK(opts->get_native_codegen());
+        CHECK(opts->get_coverage_level() == 2);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "properties - unknown and invalid keys")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        state->push_object(opts.ptr());
+        state->set_global("opts");
+
+        SUBCASE("Unknown property reads as nil")
+        {
+            exec_lua_ok("assert(opts.does_not_exist == nil)");
+        }
+
+        SUBCASE("Assigning to a method")
+        {
+            CHECK(exec_lua("opts.get_debug_level = 1") != LUA_OK);
+            CHECK(state->to_string_inplace(-1).contains("get_debug_level"));
+            state->pop(1);
+        }
+
+        SUBCASE("Wrong value type")
+        {
+            CHECK(exec_lua("opts.debug_level = {}") != LUA_OK);
+            state->pop(1);
+        }
+    }
+
+    TEST_CASE_FIXTURE(RawLuaStateFixture, "method calls - work without string atoms")
+    {
+        // RawLuaStateFixture does not install the useratom callback
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        push_object(L, opts.ptr(), LUA_NOTAG);
+        lua_setglobal(L, "opts");
+
+        CHECK(exec_lua("opts:set_type_info_level(1)") == LUA_OK);
+        CHECK(opts->get_type_info_level() == 1);
+    }
 }
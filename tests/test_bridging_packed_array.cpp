@@ -0,0 +1,159 @@
+// Tests for bridging/packed_array - native packed array userdata
+// push_packed_array, to_variant, element access from Lua
+
+#include "doctest.h"
+#include "test_fixtures.h"
+#include "lua_state.h"
+
+using namespace gdluau;
+using namespace godot;
+
+static PackedFloat32Array make_floats(std::initializer_list<float> p_values)
+{
+    PackedFloat32Array floats;
+    for (float value : p_values)
+    {
+        floats.push_back(value);
+    }
+    return floats;
+}
+
+TEST_SUITE("Bridging - Packed Array")
+{
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_variant - packed arrays are shared, not copied")
+    {
+        PackedFloat32Array floats = make_floats({1.0f, 2.0f, 3.0f});
+        state->push_variant(floats);
+        CHECK(state->is_userdata(-1));
+
+        Variant result = state->to_variant(-1);
+        CHECK(result.get_type() == Variant::PACKED_FLOAT32_ARRAY);
+        CHECK(PackedFloat32Array(result).ptr() == floats.ptr());
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "index - reads elements with 0-based and negative indices")
+    {
+        state->push_variant(make_floats({1.5f, 2.5f, 3.5f}));
+        state->set_global("arr");
+
+        CHECK(exec_lua("return #arr, arr[0], arr[2], arr[-1]") == LUA_OK);
+        CHECK(state->to_number(-4) == 3);
+        CHECK(state->to_number(-3) == doctest::Approx(1.5));
+        CHECK(state->to_number(-2) == doctest::Approx(3.5));
+        CHECK(state->to_number(-1) == doctest::Approx(3.5));
+        state->pop(4);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "index - out of range access errors")
+    {
+        state->push_variant(make_floats({1.0f, 2.0f}));
+        state->set_global("arr");
+
+        CHECK(exec_lua("return arr[2]") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("out of range"));
+        state->pop(1);
+
+        CHECK(exec_lua("arr[-3] = 0") == LUA_ERRRUN);
+        state->pop(1);
+
+        CHECK(exec_lua("return arr[0.5]") == LUA_ERRRUN);
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "newindex - writes are copy-on-write")
+    {
+        PackedFloat32Array floats = make_floats({0.0f, 0.0f});
+        state->push_variant(floats);
+        state->set_global("arr");
+
+        exec_lua_ok("arr[1] = 4.25");
+
+        // Original array is untouched
+        CHECK(floats[1] == 0.0f);
+
+        state->get_global("arr");
+        PackedFloat32Array result = state->to_variant(-1);
+        CHECK(result[1] == doctest::Approx(4.25));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "iter - yields indices and elements")
+    {
+        PackedVector3Array vertices;
+        vertices.push_back(Vector3(1, 0, 0));
+        vertices.push_back(Vector3(0, 2, 0));
+        vertices.push_back(Vector3(0, 0, 3));
+        state->push_variant(vertices);
+        state->set_global("vertices");
+
+        CHECK(exec_lua(R"(
+            local count, index_sum, total = 0, 0, Vector3(0, 0, 0)
+            for i, v in vertices do
+                count += 1
+                index_sum += i
+                total += v
+            end
+            return count, index_sum, total
+        )") == LUA_OK);
+
+        CHECK(state->to_number(-3) == 3);
+        CHECK(state->to_number(-2) == 3);
+        CHECK(state->to_vector3(-1) == Vector3(1, 2, 3));
+        state->pop(3);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "namecall - calls Godot methods on the array")
+    {
+        PackedInt32Array ints;
+        ints.push_back(3);
+        ints.push_back(1);
+        state->push_variant(ints);
+        state->set_global("arr");
+
+        exec_lua_ok("arr:append(2); arr:sort()");
+
+        CHECK(exec_lua("return arr:size(), arr[0], arr[2], arr:has(3)") == LUA_OK);
+        CHECK(state->to_number(-4) == 3);
+        CHECK(state->to_number(-3) == 1);
+        CHECK(state->to_number(-2) == 3);
+        CHECK(state->to_boolean(-1));
+        state->pop(4);
+
+        // Original array is untouched
+        CHECK(ints.size() == 2);
+
+        CHECK(exec_lua("arr:not_a_method()") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("PackedInt32Array.not_a_method"));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "PackedStringArray - reads and writes strings")
+    {
+        PackedStringArray strings;
+        strings.push_back("hello");
+        strings.push_back("world");
+        state->push_variant(strings);
+        state->set_global("strings");
+
+        exec_lua_ok("strings[1] = 'luau'");
+        CHECK(exec_lua("return strings[0] .. ' ' .. strings[1]") == LUA_OK);
+        CHECK(String(state->to_string_inplace(-1)) == "hello luau");
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "operators - equality and concatenation")
+    {
+        state->push_variant(make_floats({1.0f, 2.0f}));
+        state->set_global("a");
+        state->push_variant(make_floats({1.0f, 2.0f}));
+        state->set_global("b");
+
+        CHECK(exec_lua("local c = a + b; return a == b, #c, tostring(a)") == LUA_OK);
+        CHECK(state->to_boolean(-3));
+        CHECK(state->to_number(-2) == 4);
+        CHECK(String(state->to_string_inplace(-1)).begins_with("["));
+        state->pop(3);
+    }
+}
@@ -4,6 +4,10 @@
 #include "doctest.h"
 #include "test_fixtures.h"
 #include "lua_state.h"
+#include "bridging/variant.h"
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 
 using namespace gdluau;
 using namespace godot;
@@ -247,6 +251,63 @@ TEST_SUITE("Bridging - Variant - Type Conversions")
 
         state->pop(1);
     }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_variant - from Lua table (mixed array and hash parts)")
+    {
+        CHECK(exec_lua("return {10, 20, 30, name = 'mixed', [5] = 50}") == LUA_OK);
+
+        Variant result = state->to_variant(-1);
+
+        CHECK(result.get_type() == Variant::DICTIONARY);
+        Dictionary dict = result;
+        CHECK(dict.size() == 5);
+        CHECK(static_cast<int>(dict[1]) == 10);
+        CHECK(static_cast<int>(dict[2]) == 20);
+        CHECK(static_cast<int>(dict[3]) == 30);
+        CHECK(static_cast<int>(dict[5]) == 50);
+        CHECK(static_cast<String>(dict["name"]) == "mixed");
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_variant - from Lua table (array with holes)")
+    {
+        CHECK(exec_lua("local t = table.create(8); t[1] = 1; t[2] = 2; t[4] = 4; return t") == LUA_OK);
+
+        Variant result = state->to_variant(-1);
+
+        CHECK(result.get_type() == Variant::DICTIONARY);
+        Dictionary dict = result;
+        CHECK(dict.size() == 3);
+        CHECK(static_cast<int>(dict[4]) == 4);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "to_variant - from Lua table (array built in the hash part)")
+    {
+        CHECK(exec_lua("local t = {}; t[3] = 'c'; t[2] = 'b'; t[1] = 'a'; return t") == LUA_OK);
+
+        Variant result = state->to_variant(-1);
+
+        // Whether this is an Array depends on where Luau stored the keys, but the contents must be intact
+        if (result.get_type() == Variant::ARRAY)
+        {
+            Array arr = result;
+            CHECK(arr.size() == 3);
+            CHECK(static_cast<String>(arr[0]) == "a");
+        }
+        else
+        {
+            REQUIRE(result.get_type() == Variant::DICTIONARY);
+            Dictionary dict = result;
+            CHECK(dict.size() == 3);
+            CHECK(static_cast<String>(dict[1]) == "a");
+            CHECK(static_cast<String>(dict[3]) == "c");
+        }
+
+        state->pop(1);
+    }
 }
 
 TEST_SUITE("Bridging - Variant - Complex Types")
@@ -510,6 +571,127 @@ TEST_SUITE("Bridging - Variant - Edge Cases")
         state->pop(1);
     }
 
+    TEST_CASE_FIXTURE(LuaStateFixture, "variant - shared tables convert to the same container")
+    {
+        CHECK(exec_lua("local shared = {1, 2}; return {a = shared, b = shared, list = {shared, shared}}") == LUA_OK);
+
+        Dictionary result = state->to_variant(-1);
+        Array list = result["list"];
+
+        CHECK(UtilityFunctions::is_same(result["a"], result["b"]));
+        CHECK(UtilityFunctions::is_same(list[0], result["a"]));
+        CHECK(UtilityFunctions::is_same(list[1], result["a"]));
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "variant - self-referencing tables")
+    {
+        // Cycles are broken, so the results don't contain themselves and can be freed
+        CHECK(exec_lua("local t = {name = 'node'}; t.self = t; return t") == LUA_OK);
+        Dictionary dict = state->to_variant(-1);
+        CHECK(dict["name"] == Variant("node"));
+        CHECK(dict.has("self"));
+        CHECK(dict["self"].get_type() == Variant::NIL);
+        state->pop(1);
+
+        CHECK(exec_lua("local t = {1}; t[2] = t; return t") == LUA_OK);
+        Array arr = state->to_variant(-1);
+        REQUIRE(arr.size() == 2);
+        CHECK(static_cast<int>(arr[0]) == 1);
+        CHECK(arr[1].get_type() == Variant::NIL);
+        state->pop(1);
+
+        CHECK(exec_lua("local t = {}; t[1] = t; t.name = 'mixed'; return t") == LUA_OK);
+        Dictionary mixed = state->to_variant(-1);
+        CHECK(mixed[1].get_type() == Variant::NIL);
+        CHECK(mixed["name"] == Variant("mixed"));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "variant - converting a cycle does not leak")
+    {
+        Ref<RefCounted> payload = memnew(RefCounted);
+        state->push_variant(payload);
+        state->set_global("payload");
+
+        CHECK(exec_lua("local t = {payload = payload}; t.self = t; return t") == LUA_OK);
+        int baseline = payload->get_reference_count();
+
+        {
+            Dictionary dict = state->to_variant(-1);
+            CHECK(payload->get_reference_count() == baseline + 1);
+        }
+
+        // The Dictionary didn't hold itself, so it was freed along with its reference to the payload
+        CHECK(payload->get_reference_count() == baseline);
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "variant - trees with parent links")
+    {
+        // Every node refers to its parent while its children are being converted. Each node must still only be
+        // converted once, or this depth would not finish.
+        CHECK(exec_lua(R"(
+            local root = {name = 'root'}
+            local node = root
+            for i = 1, 64 do
+                local child = {parent = node, name = 'child'}
+                node[1] = child
+                node = child
+            end
+            return root
+        )") == LUA_OK);
+
+        Dictionary node = state->to_variant(-1);
+        int depth = 0;
+        while (node.has(1))
+        {
+            Dictionary child = node[1];
+            CHECK(child["parent"].get_type() == Variant::NIL);
+            CHECK(child["name"] == Variant("child"));
+            node = child;
+            depth++;
+        }
+        CHECK(depth == 64);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "variant - self-referencing tables via to_array and to_dictionary")
+    {
+        CHECK(exec_lua("local t = {1}; t[2] = {parent = t}; return t") == LUA_OK);
+        Array arr = state->to_array(-1);
+        REQUIRE(arr.size() == 2);
+        Dictionary child = arr[1];
+        CHECK(child.has("parent"));
+        CHECK(child["parent"].get_type() == Variant::NIL);
+        state->pop(1);
+
+        CHECK(exec_lua("local t = {}; t.self = t; return t") == LUA_OK);
+        Dictionary dict = state->to_dictionary(-1);
+        CHECK(dict["self"].get_type() == Variant::NIL);
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "variant - nesting beyond the depth limit")
+    {
+        CHECK(exec_lua("local root = {}; local t = root; for i = 1, 300 do t.child = {}; t = t.child end; return root") == LUA_OK);
+
+        Dictionary result = state->to_variant(-1);
+
+        int depth = 1;
+        while (result.has("child") && result["child"].get_type() == Variant::DICTIONARY)
+        {
+            Dictionary child = result["child"];
+            result = child;
+            depth++;
+        }
+        CHECK(depth == ConversionContext::DEFAULT_MAX_DEPTH);
+
+        state->pop(1);
+    }
+
     TEST_CASE_FIXTURE(LuaStateFixture, "variant - unicode strings")
     {
         String unicode = "Hello 世界 🌍";
@@ -522,3 +704,84 @@ TEST_SUITE("Bridging - Variant - Edge Cases")
         state->pop(1);
     }
 }
+
+static constexpr real_t HALF_PI = 1.5707963267948966;
+
+TEST_SUITE("Bridging - Variant - Metamethods")
+{
+    TEST_CASE_FIXTURE(LuaStateFixture, "index - geometry members")
+    {
+        Transform3D xform(Basis(Vector3(0, 1, 0), HALF_PI), Vector3(1, 2, 3));
+        state->push_variant(xform);
+        state->set_global("xform");
+        state->push_variant(Color(0.25, 0.5, 0.75, 1.0));
+        state->set_global("color");
+
+        CHECK(exec_lua("return xform.origin, xform.basis.y, color.g, color.a") == LUA_OK);
+        CHECK(state->to_vector3(-4) == Vector3(1, 2, 3));
+        CHECK(state->to_vector3(-3).is_equal_approx(Vector3(0, 1, 0)));
+        CHECK(state->to_number(-2) == doctest::Approx(0.5));
+        CHECK(state->to_number(-1) == doctest::Approx(1.0));
+        state->pop(4);
+
+        // Members without a fast path go through Variant::get_named()
+        CHECK(exec_lua("return color.h, color.r8") == LUA_OK);
+        CHECK(state->to_number(-2) == doctest::Approx(Color(0.25, 0.5, 0.75, 1.0).get_h()));
+        CHECK(state->to_number(-1) == 64);
+        state->pop(2);
+
+        CHECK(exec_lua("return xform.nonexistent") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("Cannot index"));
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "newindex - modifies the Variant in place")
+    {
+        state->push_variant(Vector2(1, 2));
+        state->set_global("vec");
+
+        exec_lua_ok("vec.x = 5; vec.y = vec.x + 1");
+
+        state->get_global("vec");
+        Vector2 vec = state->to_variant(-1);
+        CHECK(vec == Vector2(5, 6));
+        state->pop(1);
+
+        CHECK(exec_lua("vec.nonexistent = 1") == LUA_ERRRUN);
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "operators - transforming vectors")
+    {
+        Basis basis(Vector3(0, 0, 1), HALF_PI);
+        state->push_variant(Transform3D(basis, Vector3(10, 0, 0)));
+        state->set_global("xform");
+        state->push_variant(basis);
+        state->set_global("basis");
+        state->push_variant(Quaternion(basis));
+        state->set_global("quat");
+        state->push_variant(Transform2D(0, Vector2(3, 4)));
+        state->set_global("xform2d");
+
+        CHECK(exec_lua("return xform * Vector3(1, 0, 0), basis * Vector3(1, 0, 0), quat * Vector3(1, 0, 0), xform2d * Vector2(1, 1)") == LUA_OK);
+        CHECK(state->to_vector3(-4).is_equal_approx(Vector3(10, 1, 0)));
+        CHECK(state->to_vector3(-3).is_equal_approx(Vector3(0, 1, 0)));
+        CHECK(state->to_vector3(-2).is_equal_approx(Vector3(0, 1, 0)));
+        Vector2 transformed = state->to_variant(-1);
+        CHECK(transformed == Vector2(4, 5));
+        state->pop(4);
+
+        // Operators without a fast path go through Variant::evaluate()
+        CHECK(exec_lua("return -Vector2(1, 2), Vector2(1, 2) * 2, xform * xform") == LUA_OK);
+        Vector2 negated = state->to_variant(-3);
+        Vector2 scaled = state->to_variant(-2);
+        CHECK(negated == Vector2(-1, -2));
+        CHECK(scaled == Vector2(2, 4));
+        CHECK(state->to_variant(-1).get_type() == Variant::TRANSFORM3D);
+        state->pop(3);
+
+        CHECK(exec_lua("return xform * 'string'") == LUA_ERRRUN);
+        CHECK(String(state->to_string_inplace(-1)).contains("Cannot use operator"));
+        state->pop(1);
+    }
+}
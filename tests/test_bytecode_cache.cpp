@@ -0,0 +1,185 @@
+// Tests for bytecode_cache - persistent on-disk bytecode cache
+// get_bytecode_cache_key, load_cached_bytecode, store_cached_bytecode, LuauScript integration
+
+#include "doctest.h"
+#include "bytecode_cache.h"
+#include "lua_compileoptions.h"
+#include "luau.h"
+#include "luau_script.h"
+
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+
+using namespace gdluau;
+using namespace godot;
+
+static String entry_path(const String &p_key)
+{
+    return get_bytecode_cache_dir().path_join(p_key + ".bin");
+}
+
+// Enables the cache for the duration of a test, and removes the entries it created
+struct BytecodeCacheFixture
+{
+    bool was_enabled = is_bytecode_cache_enabled();
+    PackedStringArray keys;
+
+    BytecodeCacheFixture()
+    {
+        initialize_bytecode_cache(true);
+    }
+
+    ~BytecodeCacheFixture()
+    {
+        for (const String &key : keys)
+        {
+            DirAccess::remove_absolute(entry_path(key));
+        }
+
+        initialize_bytecode_cache(was_enabled);
+    }
+
+    String key_for(const String &p_source, const LuaCompileOptions *p_options = nullptr)
+    {
+        String key = get_bytecode_cache_key(p_source, p_options);
+        keys.push_back(key);
+        return key;
+    }
+};
+
+TEST_SUITE("BytecodeCache")
+{
+    TEST_CASE("get_bytecode_cache_key - depends on source and options")
+    {
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+        String key = get_bytecode_cache_key("return 1", options.ptr());
+
+        CHECK(key.length() == 64);
+        CHECK(key == get_bytecode_cache_key("return 1", options.ptr()));
+        CHECK(key == get_bytecode_cache_key("return 1", nullptr));
+        CHECK(key != get_bytecode_cache_key("return 2", options.ptr()));
+
+        options->set_optimization_level(2);
+        CHECK(key != get_bytecode_cache_key("return 1", options.ptr()));
+    }
+
+    TEST_CASE("get_bytecode_cache_key - depends on library constants")
+    {
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+
+        Dictionary members;
+        members["LIMIT"] = 1;
+        Dictionary constants;
+        constants["game"] = members;
+        options->set_library_constants(constants);
+        String key = get_bytecode_cache_key("return game.LIMIT", options.ptr());
+
+        CHECK(key != get_bytecode_cache_key("return game.LIMIT", nullptr));
+
+        // Insertion order doesn't matter
+        Dictionary reordered_members;
+        reordered_members["OTHER"] = 2;
+        reordered_members["LIMIT"] = 1;
+        Dictionary reordered_constants;
+        reordered_constants["game"] = reordered_members;
+
+        Dictionary extended_members;
+        extended_members["LIMIT"] = 1;
+        extended_members["OTHER"] = 2;
+        Dictionary extended_constants;
+        extended_constants["game"] = extended_members;
+
+        Ref<LuaCompileOptions> reordered;
+        reordered.instantiate();
+        reordered->set_library_constants(reordered_constants);
+        options->set_library_constants(extended_constants);
+        CHECK(get_bytecode_cache_key("return game.LIMIT", options.ptr()) == get_bytecode_cache_key("return game.LIMIT", reordered.ptr()));
+        options->set_library_constants(constants);
+
+        // Folds to a string rather than a number
+        members["LIMIT"] = "1";
+        options->set_library_constants(constants);
+        CHECK(key != get_bytecode_cache_key("return game.LIMIT", options.ptr()));
+    }
+
+    TEST_CASE_FIXTURE(BytecodeCacheFixture, "store_cached_bytecode and load_cached_bytecode - round-trip")
+    {
+        String key = key_for("-- round-trip test");
+        PackedByteArray bytecode = Luau::compile("-- round-trip test");
+
+        PackedByteArray loaded;
+        CHECK_FALSE(load_cached_bytecode(key, loaded));
+
+        store_cached_bytecode(key, bytecode);
+        REQUIRE(load_cached_bytecode(key, loaded));
+        CHECK(loaded == bytecode);
+    }
+
+    TEST_CASE_FIXTURE(BytecodeCacheFixture, "load_cached_bytecode - rejects truncated entries")
+    {
+        String key = key_for("-- truncated entry test");
+        PackedByteArray bytecode = Luau::compile("-- truncated entry test");
+        store_cached_bytecode(key, bytecode);
+
+        PackedByteArray contents = FileAccess::get_file_as_bytes(entry_path(key));
+        contents.resize(contents.size() - 1);
+
+        Ref<FileAccess> file = FileAccess::open(entry_path(key), FileAccess::WRITE);
+        REQUIRE(file.is_valid());
+        file->store_buffer(contents);
+        file->close();
+
+        PackedByteArray loaded;
+        CHECK_FALSE(load_cached_bytecode(key, loaded));
+    }
+
+    TEST_CASE_FIXTURE(BytecodeCacheFixture, "LuauScript.compile - stores and reuses cached bytecode")
+    {
+        String source = "return 'bytecode cache test'";
+        String key = key_for(source);
+
+        Ref<LuauScript> script = memnew(LuauScript);
+        script->set_source_code(source);
+        PackedByteArray bytecode = script->compile();
+
+        PackedByteArray loaded;
+        REQUIRE(load_cached_bytecode(key, loaded));
+        CHECK(loaded == bytecode);
+
+        // Another script with the same source is served from disk, not recompiled
+        PackedByteArray marker;
+        marker.push_back(0xFF);
+        store_cached_bytecode(key, marker);
+
+        Ref<LuauScript> other = memnew(LuauScript);
+        other->set_source_code(source);
+        CHECK(other->load_cached_bytecode());
+        CHECK(other->compile() == marker);
+
+        // Forcing a recompile bypasses and refreshes the cache
+        CHECK(other->compile(true) == bytecode);
+        REQUIRE(load_cached_bytecode(key, loaded));
+        CHECK(loaded == bytecode);
+    }
+
+    TEST_CASE_FIXTURE(BytecodeCacheFixture, "LuauScript.compile - keyed by compile options")
+    {
+        String source = "return 'options key test'";
+
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+        options->set_optimization_level(2);
+        String key = key_for(source, options.ptr());
+
+        Ref<LuauScript> script = memnew(LuauScript);
+        script->set_source_code(source);
+        script->set_compile_options(options.ptr());
+        script->compile();
+
+        PackedByteArray loaded;
+        CHECK(load_cached_bytecode(key, loaded));
+        CHECK_FALSE(load_cached_bytecode(key_for(source), loaded));
+    }
+}
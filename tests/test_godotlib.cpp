@@ -1063,4 +1063,100 @@ TEST_SUITE("lua_godotlib - PackedArrays")
 
 		lua_pop(L, 1);
 	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "PackedVector3Array constructor from array of vectors")
+	{
+		exec_lua("return PackedVector3Array({Vector3(1, 2, 3), Vector3(4, 5, 6)})");
+
+		Variant result = to_variant(L, -1);
+		CHECK(result.get_type() == Variant::PACKED_VECTOR3_ARRAY);
+
+		PackedVector3Array arr = result;
+		CHECK(arr.size() == 2);
+		CHECK(arr[0] == Vector3(1, 2, 3));
+		CHECK(arr[1] == Vector3(4, 5, 6));
+
+		lua_pop(L, 1);
+	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "PackedFloat32Array constructor from buffer")
+	{
+		exec_lua("local b = buffer.create(8); buffer.writef32(b, 0, 1.5); buffer.writef32(b, 4, -2); return PackedFloat32Array(b)");
+
+		Variant result = to_variant(L, -1);
+		CHECK(result.get_type() == Variant::PACKED_FLOAT32_ARRAY);
+
+		PackedFloat32Array arr = result;
+		CHECK(arr.size() == 2);
+		CHECK(arr[0] == doctest::Approx(1.5));
+		CHECK(arr[1] == doctest::Approx(-2.0));
+
+		lua_pop(L, 1);
+	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "PackedInt32Array constructor from buffer with partial element fails")
+	{
+		CHECK(exec_lua("return PackedInt32Array(buffer.create(6))") != LUA_OK);
+		lua_pop(L, 1);
+	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "PackedInt64Array constructor rejects other types")
+	{
+		CHECK(exec_lua("return PackedInt64Array(42)") != LUA_OK);
+		CHECK(String(lua_tostring(L, -1)).contains("table, buffer or packed array"));
+		lua_pop(L, 1);
+	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "PackedByteArray constructor from table")
+	{
+		exec_lua("return PackedByteArray({1, 2, 255})");
+		REQUIRE(lua_isbuffer(L, -1));
+
+		size_t len;
+		const uint8_t *data = static_cast<const uint8_t *>(lua_tobuffer(L, -1, &len));
+		CHECK(len == 3);
+		CHECK(data[0] == 1);
+		CHECK(data[1] == 2);
+		CHECK(data[2] == 255);
+
+		lua_pop(L, 1);
+	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "godot.tobuffer and godot.totable round-trip")
+	{
+		exec_lua(R"(
+			local packed = PackedInt32Array({7, -8, 9})
+			local buf = godot.tobuffer(packed)
+			local copy = PackedInt32Array(buf)
+			local t = godot.totable(copy)
+			return buffer.len(buf), buffer.readi32(buf, 4), #t, t[1], t[2], t[3]
+		)");
+
+		CHECK(lua_tonumber(L, -6) == 12);
+		CHECK(lua_tonumber(L, -5) == -8);
+		CHECK(lua_tonumber(L, -4) == 3);
+		CHECK(lua_tonumber(L, -3) == 7);
+		CHECK(lua_tonumber(L, -2) == -8);
+		CHECK(lua_tonumber(L, -1) == 9);
+
+		lua_pop(L, 6);
+	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "godot.totable on PackedStringArray")
+	{
+		exec_lua("local t = godot.totable(PackedStringArray({'a', 'bc'})); return #t, t[1], t[2]");
+
+		CHECK(lua_tonumber(L, -3) == 2);
+		CHECK(String(lua_tostring(L, -2)) == "a");
+		CHECK(String(lua_tostring(L, -1)) == "bc");
+
+		lua_pop(L, 3);
+	}
+
+	TEST_CASE_FIXTURE(RawLuaStateFixture, "godot.tobuffer rejects non-packed values")
+	{
+		CHECK(exec_lua("return godot.tobuffer({1, 2, 3})") != LUA_OK);
+		CHECK(String(lua_tostring(L, -1)).contains("packed array"));
+		lua_pop(L, 1);
+	}
 }
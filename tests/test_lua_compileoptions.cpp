@@ -91,4 +91,109 @@ TEST_SUITE("LuaCompileOptions")
         CHECK(defaults.typeInfoLevel == 0);
         CHECK(defaults.coverageLevel == 0);
     }
+
+    TEST_CASE("vector options - default to Vector3 without a library")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        CHECK(opts->get_vector_lib() == "");
+        CHECK(opts->get_vector_ctor() == "Vector3");
+        CHECK(opts->get_vector_type() == "Vector3");
+        CHECK(opts->get_options().vectorLib == nullptr);
+        CHECK(strcmp(opts->get_options().vectorCtor, "Vector3") == 0);
+
+        opts->set_vector_ctor("");
+        CHECK(opts->get_options().vectorCtor == nullptr);
+    }
+
+    TEST_CASE("set_mutable_globals and set_userdata_types - null-terminated lists")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+        CHECK(opts->get_options().mutableGlobals == nullptr);
+
+        PackedStringArray names;
+        names.push_back("state");
+        names.push_back("config");
+        opts->set_mutable_globals(names);
+        opts->set_userdata_types(names);
+
+        CHECK(opts->get_mutable_globals() == names);
+        const char *const *globals = opts->get_options().mutableGlobals;
+        REQUIRE(globals != nullptr);
+        CHECK(strcmp(globals[0], "state") == 0);
+        CHECK(strcmp(globals[1], "config") == 0);
+        CHECK(globals[2] == nullptr);
+        CHECK(strcmp(opts->get_options().userdataTypes[1], "config") == 0);
+
+        opts->set_mutable_globals(PackedStringArray());
+        CHECK(opts->get_options().mutableGlobals == nullptr);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "set_library_constants - folds library members")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        Dictionary members;
+        members["ANSWER"] = 42;
+        members["NAME"] = "luau";
+        members["UP"] = Vector3(0, 1, 0);
+        Dictionary constants;
+        constants["game"] = members;
+        opts->set_library_constants(constants);
+
+        CHECK(opts->get_library_constants() == constants);
+        REQUIRE(opts->get_options().librariesWithKnownMembers != nullptr);
+        CHECK(strcmp(opts->get_options().librariesWithKnownMembers[0], "game") == 0);
+
+        // `game` does not exist at runtime, so these only succeed if folded at compile time
+        PackedByteArray bytecode = Luau::compile("return game.ANSWER, game.NAME, game.UP", opts.ptr());
+        REQUIRE(state->load_bytecode(bytecode, "folded"));
+        REQUIRE(state->pcall(0, 3) == LUA_OK);
+
+        CHECK(state->to_number(-3) == 42);
+        CHECK(state->to_string_inplace(-2) == "luau");
+        CHECK(state->to_variant(-1) == Variant(Vector3(0, 1, 0)));
+        state->pop(3);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "set_library_constants - unknown members are not folded")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        Dictionary members;
+        members["ANSWER"] = 42;
+        Dictionary constants;
+        constants["game"] = members;
+        opts->set_library_constants(constants);
+
+        PackedByteArray bytecode = Luau::compile("return game.OTHER", opts.ptr());
+        REQUIRE(state->load_bytecode(bytecode, "unfolded"));
+        CHECK(state->pcall(0, 1) != LUA_OK); // Indexes the nil global at runtime
+        state->pop(1);
+    }
+
+    TEST_CASE("set_library_member_types - declares libraries")
+    {
+        Ref<LuaCompileOptions> opts;
+        opts.instantiate();
+
+        Dictionary members;
+        members["player"] = Variant::OBJECT;
+        Dictionary types;
+        types["game"] = members;
+        opts->set_library_member_types(types);
+
+        CHECK(opts->get_library_member_types() == types);
+        REQUIRE(opts->get_options().librariesWithKnownMembers != nullptr);
+        CHECK(strcmp(opts->get_options().librariesWithKnownMembers[0], "game") == 0);
+        CHECK(opts->get_options().libraryMemberTypeCb != nullptr);
+
+        PackedByteArray bytecode = Luau::compile("return game.player", opts.ptr());
+        CHECK(bytecode.size() > 0);
+        CHECK(bytecode[0] != 0);
+    }
 }
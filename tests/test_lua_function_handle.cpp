@@ -0,0 +1,112 @@
+// Tests for LuaFunctionHandle class
+// prepare_call, invoke, invoke_multi, handle lifecycle
+
+#include "doctest.h"
+#include "test_fixtures.h"
+#include "lua_function_handle.h"
+#include "lua_state.h"
+
+using namespace gdluau;
+using namespace godot;
+
+TEST_SUITE("LuaFunctionHandle")
+{
+    TEST_CASE_FIXTURE(LuaStateFixture, "prepare_call - by global name")
+    {
+        exec_lua_ok("function add(a, b) return a + b end");
+
+        Ref<LuaFunctionHandle> add = state->prepare_call("add");
+        REQUIRE(add.is_valid());
+        CHECK(add->is_valid());
+        CHECK(add->get_state() == state);
+        CHECK(state->get_top() == 0);
+
+        CHECK(static_cast<int>(add->call("invoke", 2, 3)) == 5);
+        CHECK(static_cast<int>(add->call("invoke", 10, 32)) == 42);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "prepare_call - by stack index")
+    {
+        CHECK(exec_lua("return function(name) return 'hello ' .. name end") == LUA_OK);
+
+        Ref<LuaFunctionHandle> greet = state->prepare_call(-1);
+        REQUIRE(greet.is_valid());
+        CHECK(state->get_top() == 1); // The function is left on the stack
+        state->pop(1);
+
+        CHECK(greet->call("invoke", "world") == Variant("hello world"));
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "prepare_call - callable tables")
+    {
+        exec_lua_ok("counter = setmetatable({count = 0}, {__call = function(self, n) self.count += n; return self.count end})");
+
+        Ref<LuaFunctionHandle> counter = state->prepare_call("counter");
+        REQUIRE(counter.is_valid());
+
+        counter->call("invoke", 2);
+        CHECK(static_cast<int>(counter->call("invoke", 3)) == 5);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "prepare_call - not callable")
+    {
+        exec_lua_ok("not_a_function = 42");
+
+        CHECK(state->prepare_call("not_a_function").is_null());
+        CHECK(state->prepare_call("missing").is_null());
+        CHECK(state->get_top() == 0);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "invoke_multi - returns all results")
+    {
+        exec_lua_ok("function divmod(a, b) return a // b, a % b end");
+
+        Ref<LuaFunctionHandle> divmod = state->prepare_call("divmod");
+        Array results = divmod->call("invoke_multi", 17, 5);
+
+        REQUIRE(results.size() == 2);
+        CHECK(static_cast<int>(results[0]) == 3);
+        CHECK(static_cast<int>(results[1]) == 2);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "invoke - errors leave the stack balanced")
+    {
+        exec_lua_ok("function failing() error('test error') end");
+
+        Ref<LuaFunctionHandle> failing = state->prepare_call("failing");
+        CHECK(failing->call("invoke") == Variant());
+        CHECK(state->get_top() == 0);
+    }
+
+    TEST_CASE("invoke - closed state")
+    {
+        Ref<LuaState> state = memnew(LuaState);
+        state->do_string("function f() return 1 end");
+
+        Ref<LuaFunctionHandle> f = state->prepare_call("f");
+        REQUIRE(f.is_valid());
+
+        state->close();
+        CHECK_FALSE(f->is_valid());
+    }
+
+    TEST_CASE("handle - does not keep its state alive")
+    {
+        Ref<LuaState> state = memnew(LuaState);
+        state->do_string("function f() return 1 end");
+
+        Ref<LuaFunctionHandle> f = state->prepare_call("f");
+        REQUIRE(f.is_valid());
+
+        // Stored in its own state, which would form a cycle with a strong reference
+        state->push_variant(f);
+        state->set_global("handle");
+
+        ObjectID state_id = state->get_instance_id();
+        state.unref();
+
+        CHECK(ObjectDB::get_instance(state_id) == nullptr);
+        CHECK_FALSE(f->is_valid());
+        CHECK(f->get_state().is_null());
+    }
+}
@@ -6,6 +6,8 @@
 #include "lua_state.h"
 #include "luau.h"
 
+#include <luacodegen.h>
+
 using namespace gdluau;
 using namespace godot;
 
@@ -104,6 +106,69 @@ TEST_SUITE("LuaState - Code Loading")
     }
 }
 
+TEST_SUITE("LuaState - Native Code Generation")
+{
+    TEST_CASE_FIXTURE(LuaStateFixture, "enable_codegen - reports platform support")
+    {
+        CHECK_FALSE(state->is_codegen_enabled());
+
+        bool enabled = state->enable_codegen();
+        CHECK(enabled == (luau_codegen_supported() != 0));
+        CHECK(state->is_codegen_enabled() == enabled);
+
+        // Repeated calls are harmless, and threads share the VM's setting
+        CHECK(state->enable_codegen() == enabled);
+
+        Ref<LuaState> thread = state->new_thread();
+        CHECK(thread->is_codegen_enabled() == enabled);
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "compile_native - executes with same results")
+    {
+        if (!state->enable_codegen())
+        {
+            MESSAGE("Native code generation unsupported on this platform, skipping");
+            return;
+        }
+
+        bool loaded = state->load_string(R"(
+            local sum = Vector3(0, 0, 0)
+            for i = 1, 100 do
+                sum += Vector3(i, i * 2, i * 3)
+            end
+            return sum
+        )", "test");
+        REQUIRE(loaded);
+
+        CHECK(state->compile_native(-1));
+
+        lua_Status status = state->pcall(0, 1);
+        CHECK(status == LUA_OK);
+        CHECK(state->to_vector3(-1) == Vector3(5050, 10100, 15150));
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "load_bytecode - honours native_codegen option")
+    {
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+        options->set_native_codegen(true);
+
+        PackedByteArray bytecode = Luau::compile("local x = 0 for i = 1, 10 do x += i end return x", options.ptr());
+        bool loaded = state->load_bytecode(bytecode, "test_chunk", 0, options);
+        CHECK(loaded);
+        CHECK(state->is_codegen_enabled() == (luau_codegen_supported() != 0));
+
+        lua_Status status = state->pcall(0, 1);
+        CHECK(status == LUA_OK);
+        CHECK(state->to_number(-1) == 55.0);
+
+        state->pop(1);
+    }
+}
+
 TEST_SUITE("LuaState - Function Calls")
 {
     TEST_CASE_FIXTURE(LuaStateFixture, "call - basic function call")
@@ -197,6 +262,50 @@ TEST_SUITE("LuaState - Function Calls")
 
         state->pop(2); // Pop error message and error handler
     }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "push_values and pop_values - in stack order")
+    {
+        state->push_values(Array::make(1, "two", Vector3(3, 3, 3)));
+        CHECK(state->get_top() == 3);
+        CHECK(state->to_number(1) == 1);
+        CHECK(state->is_vector(3));
+
+        Array values = state->pop_values(2);
+        CHECK(state->get_top() == 1);
+        REQUIRE(values.size() == 2);
+        CHECK(values[0] == Variant("two"));
+        CHECK(values[1] == Variant(Vector3(3, 3, 3)));
+
+        CHECK(state->pop_values(0).is_empty());
+        CHECK(state->pop_values(5).is_empty()); // Stack underflow
+        CHECK(state->get_top() == 1);
+
+        state->pop(1);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "call_function - returns all results")
+    {
+        exec_lua_ok("function divmod(a, b) return a // b, a % b end");
+
+        Array results = state->call_function("divmod", Array::make(17, 5));
+
+        REQUIRE(results.size() == 2);
+        CHECK(static_cast<int>(results[0]) == 3);
+        CHECK(static_cast<int>(results[1]) == 2);
+        CHECK(state->get_top() == 0);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "call_function - errors leave the stack balanced")
+    {
+        exec_lua_ok("function failing() error('test error') end");
+        state->push_number(1);
+
+        CHECK(state->call_function("failing").is_empty());
+        CHECK(state->call_function("missing").is_empty());
+        CHECK(state->get_top() == 1);
+
+        state->pop(1);
+    }
 }
 
 TEST_SUITE("LuaState - Coroutines")
@@ -5,6 +5,8 @@
 #include "luau.h"
 #include "lua_compileoptions.h"
 
+#include <godot_cpp/templates/vector.hpp>
+
 using namespace gdluau;
 using namespace godot;
 
@@ -143,6 +145,56 @@ TEST_SUITE("Luau")
         lua_pop(L, 1);
     }
 
+    TEST_CASE("compile_async - matches synchronous compile")
+    {
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+        options->set_optimization_level(2);
+
+        Vector<Ref<LuauCompileTask>> tasks;
+        for (int i = 0; i < 8; i++)
+        {
+            tasks.push_back(Luau::compile_async(vformat("return %d", i), options.ptr()));
+        }
+
+        for (int i = 0; i < tasks.size(); i++)
+        {
+            Ref<LuauCompileTask> task = tasks[i];
+            REQUIRE(task.is_valid());
+
+            PackedByteArray bytecode = task->wait();
+            CHECK(task->is_completed());
+            CHECK(bytecode == Luau::compile(vformat("return %d", i), options.ptr()));
+
+            // Waiting again returns the same result
+            CHECK(task->wait() == bytecode);
+        }
+    }
+
+    TEST_CASE("compile_async - compiles with a snapshot of the options")
+    {
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+
+        Dictionary members;
+        members["ANSWER"] = 42;
+        Dictionary constants;
+        constants["game"] = members;
+        options->set_library_constants(constants);
+
+        const char *source = "return game.ANSWER";
+        PackedByteArray expected = Luau::compile(source, options.ptr());
+        Ref<LuauCompileTask> task = Luau::compile_async(source, options.ptr());
+
+        // Changing the options while the task runs doesn't affect it
+        members["ANSWER"] = 7;
+        options->set_library_constants(constants);
+        options->set_optimization_level(0);
+
+        CHECK(task->wait() == expected);
+        CHECK(task->wait() != Luau::compile(source, options.ptr()));
+    }
+
     TEST_CASE("upvalue_index - converts upvalue number to pseudo-index")
     {
         int idx1 = Luau::upvalue_index(1);
@@ -4,6 +4,10 @@
 #include "test_fixtures.h"
 #include "luau_script.h"
 
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+
 using namespace gdluau;
 using namespace godot;
 
@@ -70,4 +74,138 @@ end
 
         state->pop(1);
     }
+
+    TEST_CASE("encode_precompiled_script - round-trips bytecode and options")
+    {
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+        options->set_optimization_level(2);
+        options->set_debug_level(0);
+        options->set_native_codegen(true);
+        options->set_vector_ctor("");
+
+        PackedStringArray mutable_globals;
+        mutable_globals.push_back("state");
+        options->set_mutable_globals(mutable_globals);
+
+        Dictionary members;
+        members["ANSWER"] = 42;
+        Dictionary constants;
+        constants["game"] = members;
+        options->set_library_constants(constants);
+
+        PackedByteArray bytecode = Luau::compile("return 1 + 2", options.ptr());
+        PackedByteArray data = encode_precompiled_script(bytecode, options.ptr());
+
+        PackedByteArray decoded;
+        Ref<LuaCompileOptions> decoded_options;
+        REQUIRE(decode_precompiled_script(data, decoded, decoded_options) == OK);
+        CHECK(decoded == bytecode);
+        CHECK(decoded_options->get_optimization_level() == 2);
+        CHECK(decoded_options->get_debug_level() == 0);
+        CHECK(decoded_options->get_native_codegen());
+        CHECK(decoded_options->get_vector_ctor() == "");
+        CHECK(decoded_options->get_mutable_globals() == mutable_globals);
+        CHECK(decoded_options->get_library_constants() == constants);
+        CHECK(LuaCompileOptions::fingerprint(decoded_options.ptr()) == LuaCompileOptions::fingerprint(options.ptr()));
+
+        // Truncated or foreign data is rejected
+        CHECK(decode_precompiled_script(data.slice(0, data.size() - 1), decoded, decoded_options) != OK);
+        CHECK(decode_precompiled_script(bytecode, decoded, decoded_options) != OK);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "precompiled - compile returns the embedded bytecode")
+    {
+        PackedByteArray bytecode = Luau::compile("return 1 + 2");
+
+        Ref<LuauScript> script = memnew(LuauScript);
+        script->set_precompiled_bytecode(bytecode, Ref<LuaCompileOptions>());
+
+        CHECK(script->is_precompiled());
+        CHECK(script->get_source_code().is_empty());
+        CHECK(script->compile() == bytecode);
+        CHECK(script->compile(true) == bytecode);
+
+        state->load_bytecode(script->compile(), "precompiled");
+        CHECK(state->resume() == LUA_OK);
+        CHECK(state->to_number(-1) == 3.0);
+        state->pop(1);
+
+        // Setting source code turns it back into a regular script
+        script->set_source_code("return 4");
+        CHECK_FALSE(script->is_precompiled());
+    }
+
+    TEST_CASE("precompiled - set_compile_options only accepts options with the same bytecode")
+    {
+        Ref<LuaCompileOptions> embedded;
+        embedded.instantiate();
+        embedded->set_optimization_level(2);
+
+        Ref<LuauScript> script = memnew(LuauScript);
+        script->set_precompiled_bytecode(Luau::compile("return 1", embedded.ptr()), embedded);
+
+        // native_codegen only affects loading, so it can still be turned on
+        Ref<LuaCompileOptions> native;
+        native.instantiate();
+        native->set_optimization_level(2);
+        native->set_native_codegen(true);
+        script->set_compile_options(native.ptr());
+        CHECK(script->get_compile_options() == native.ptr());
+
+        // Options that would change the bytecode are rejected
+        Ref<LuaCompileOptions> different;
+        different.instantiate();
+        different->set_optimization_level(0);
+        script->set_compile_options(different.ptr());
+        CHECK(script->get_compile_options() == native.ptr());
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "ResourceFormatLoaderLuauScript - loads .luauc files")
+    {
+        const String path = "user://test_precompiled.luauc";
+
+        Ref<LuaCompileOptions> options;
+        options.instantiate();
+        options->set_optimization_level(2);
+
+        Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+        REQUIRE(file.is_valid());
+        file->store_buffer(encode_precompiled_script(Luau::compile("return 'precompiled'", options.ptr()), options.ptr()));
+        file->close();
+
+        Ref<LuauScript> script = ResourceLoader::get_singleton()->load(path, "", ResourceLoader::CACHE_MODE_IGNORE);
+        REQUIRE(script.is_valid());
+        CHECK(script->is_precompiled());
+        REQUIRE(script->get_compile_options() != nullptr);
+        CHECK(script->get_compile_options()->get_optimization_level() == 2);
+
+        state->load_bytecode(script->compile(), "precompiled");
+        CHECK(state->resume() == LUA_OK);
+        CHECK(String(state->to_string_inplace(-1)) == "precompiled");
+        state->pop(1);
+
+        DirAccess::remove_absolute(path);
+    }
+
+    TEST_CASE_FIXTURE(LuaStateFixture, "compile_async - compile() collects the background result")
+    {
+        Ref<LuauScript> script = memnew(LuauScript);
+        script->set_source_code("return 'compiled in the background'");
+        script->compile_async();
+
+        PackedByteArray bytecode = script->compile();
+        CHECK(bytecode == Luau::compile(script->get_source_code()));
+
+        state->load_bytecode(bytecode, "async");
+        CHECK(state->resume() == LUA_OK);
+        CHECK(String(state->to_string_inplace(-1)) == "compiled in the background");
+        state->pop(1);
+
+        // Changing the source discards a pending compile
+        script->set_source_code("return 1");
+        script->compile_async();
+        script->set_source_code("return 2");
+        CHECK(script->compile() == Luau::compile("return 2"));
+    }
 }